@@ -43,6 +43,14 @@ typedef struct minisketch minisketch;
 /** Determine whether support for elements of `bits` bits was compiled in. */
 MINISKETCH_API int minisketch_bits_supported(uint32_t bits);
 
+/** Implementation number that selects the fastest available implementation.
+ *
+ * When passed to minisketch_create, the implementations available for the requested
+ * element size are timed on a short workload (once per element size, per process) and
+ * the fastest one is used. minisketch_implementation reports the one that was chosen.
+ */
+#define MINISKETCH_IMPLEMENTATION_AUTO ((uint32_t)0xFFFFFFFF)
+
 /** Determine the maximum number of implementations available.
  *
  * Multiple implementations may be available for a given element size, with
@@ -56,7 +64,8 @@ MINISKETCH_API uint32_t minisketch_implementation_max(void);
 
 /** Determine if the a combination of bits and implementation number is available.
  *
- * Returns 1 if it is, 0 otherwise.
+ * Returns 1 if it is, 0 otherwise. MINISKETCH_IMPLEMENTATION_AUTO is available for
+ * every supported element size.
  */
 MINISKETCH_API int minisketch_implementation_supported(uint32_t bits, uint32_t implementation);
 
@@ -129,6 +138,18 @@ MINISKETCH_API void minisketch_deserialize(minisketch* sketch, const unsigned ch
  */
 MINISKETCH_API void minisketch_add_uint64(minisketch* sketch, uint64_t element);
 
+/** Get the number of bytes of an element of a sketch, as used by minisketch_add_bytes and
+ *  minisketch_decode_bytes. This is the element size in bits, rounded up to a multiple of 8. */
+MINISKETCH_API size_t minisketch_element_size(const minisketch* sketch);
+
+/** Add an element, given as minisketch_element_size(sketch) bytes in little-endian order, to a sketch.
+ *
+ * This is the only way to add elements of more than 64 bits (up to 128 bits are supported).
+ * As with minisketch_add_uint64, bits beyond the element size of the sketch are dropped, adding
+ * 0 is a no-op, and adding the same element a second time removes it again.
+ */
+MINISKETCH_API void minisketch_add_bytes(minisketch* sketch, const unsigned char* element);
+
 /** Merge the elements of another sketch into this sketch.
  *
  * After merging, `sketch` will contain every element that existed in one but not
@@ -153,9 +174,78 @@ MINISKETCH_API size_t minisketch_merge(minisketch* sketch, const minisketch* oth
  * filled with the elements in this sketch.
  *
  * The return value is the number of decoded elements, or -1 if decoding failed.
+ * For sketches with elements of more than 64 bits, decoding also fails if any
+ * element does not fit in a uint64_t; use minisketch_decode_bytes for those.
  */
 MINISKETCH_API ssize_t minisketch_decode(const minisketch* sketch, size_t max_elements, uint64_t* output);
 
+/** Flag for minisketch_decode_flags: output the decoded elements in increasing order. */
+#define MINISKETCH_DECODE_SORTED 1
+
+/** Flag for minisketch_decode_flags: decode using increasingly long prefixes of the sketch.
+ *
+ * Decoding is first attempted using a short prefix of the sketch, and the
+ * result is verified against the remainder before moving on to longer
+ * prefixes. The result is identical to decoding without this flag, but the
+ * cost depends on the number of elements in the sketch rather than on its
+ * capacity. This is faster when sketches typically contain far fewer elements
+ * than their capacity, and slightly slower when they are close to full.
+ */
+#define MINISKETCH_DECODE_ESCALATE 2
+
+/** Decode a sketch, with additional options.
+ *
+ * This is identical to minisketch_decode, except that `flags` (a bitwise OR of
+ * MINISKETCH_DECODE_* constants, or 0) changes how the result is produced.
+ *
+ * The return value is the number of decoded elements, or -1 if decoding failed.
+ */
+MINISKETCH_API ssize_t minisketch_decode_flags(const minisketch* sketch, size_t max_elements, uint64_t* output, uint32_t flags);
+
+/** Decode a sketch, passing each element to a callback as soon as it is found.
+ *
+ * `callback` is invoked once for every element in the sketch, with `arg` as
+ * its second argument. This permits processing elements while decoding is
+ * still in progress, and does not require an output array. Elements are
+ * passed in arbitrary order.
+ *
+ * The return value is the number of decoded elements (equal to the number of
+ * times `callback` was invoked), or -1 if decoding failed. When decoding fails,
+ * `callback` is never invoked.
+ */
+MINISKETCH_API ssize_t minisketch_decode_callback(const minisketch* sketch, size_t max_elements, void (*callback)(uint64_t element, void* arg), void* arg);
+
+/** Decode a sketch, outputting elements as bytes.
+ *
+ * `output` is a pointer to an array of `max_elements` elements of
+ * minisketch_element_size(sketch) bytes each, which will be filled with the
+ * elements in this sketch in little-endian order (in the format accepted by
+ * minisketch_add_bytes). This works for every element size, including those
+ * over 64 bits. Results are not stored in or taken from the decode cache.
+ *
+ * The return value is the number of decoded elements, or -1 if decoding failed.
+ */
+MINISKETCH_API ssize_t minisketch_decode_bytes(const minisketch* sketch, size_t max_elements, unsigned char* output);
+
+/** Configure the process-wide decode cache.
+ *
+ * When enabled, the results of decoding are remembered for up to
+ * `max_entries` distinct sketches (identified by element size,
+ * implementation, capacity, and contents), evicting the least recently used
+ * ones first. Decoding a sketch whose result is cached then only costs a
+ * comparison and a copy. This helps when the same sketches are decoded
+ * repeatedly, e.g. when reconciling with many peers.
+ *
+ * A `max_entries` of 0 (the default) disables the cache. Every call clears
+ * the cache and its statistics. The cache is safe to use from multiple
+ * threads.
+ */
+MINISKETCH_API void minisketch_decode_cache_configure(size_t max_entries);
+
+/** Get the number of decodes that were (`hits`) and were not (`misses`)
+ *  answered by the decode cache since it was last configured. */
+MINISKETCH_API void minisketch_decode_cache_stats(uint64_t* hits, uint64_t* misses);
+
 /** Compute the capacity needed to achieve a certain rate of false positives.
  *
  * A sketch with capacity c and no more than c elements can always be decoded
@@ -228,6 +318,12 @@ public:
     /** Reverse operation of ComputeCapacity. See minisketch_compute_max_elements. */
     static size_t ComputeMaxElements(uint32_t bits, size_t capacity, uint32_t fpbits) noexcept { return minisketch_compute_max_elements(bits, capacity, fpbits); }
 
+    /** Configure the decode cache. See minisketch_decode_cache_configure. */
+    static void ConfigureDecodeCache(size_t max_entries) noexcept { minisketch_decode_cache_configure(max_entries); }
+
+    /** Get decode cache statistics. See minisketch_decode_cache_stats. */
+    static void DecodeCacheStats(uint64_t& hits, uint64_t& misses) noexcept { minisketch_decode_cache_stats(&hits, &misses); }
+
     /** Construct a clone of the specified sketch. */
     Minisketch(const Minisketch& sketch) noexcept
     {
@@ -299,6 +395,17 @@ public:
         return *this;
     }
 
+    /** Return the size in bytes of elements for AddBytes() and DecodeBytes(). */
+    size_t GetElementSize() const noexcept { return minisketch_element_size(m_minisketch.get()); }
+
+    /** Add (or remove, if already present) an element given as GetElementSize() little-endian bytes
+     *  to a (valid) Minisketch object. See minisketch_add_bytes(). */
+    Minisketch& AddBytes(const unsigned char* element) noexcept
+    {
+        minisketch_add_bytes(m_minisketch.get(), element);
+        return *this;
+    }
+
     /** Merge sketch into *this; both have to be valid Minisketch objects.
      *  See minisketch_merge for details. */
     Minisketch& Merge(const Minisketch& sketch) noexcept
@@ -317,6 +424,38 @@ public:
         return true;
     }
 
+    /** Decode this (valid) Minisketch object into the result vector, up to as many elements as the
+     *  vector's size permits, using the specified MINISKETCH_DECODE_* flags. */
+    bool Decode(std::vector<uint64_t>& result, uint32_t flags) const
+    {
+        ssize_t ret = minisketch_decode_flags(m_minisketch.get(), result.size(), result.data(), flags);
+        if (ret == -1) return false;
+        result.resize(ret);
+        return true;
+    }
+
+    /** Decode this (valid) Minisketch object up to max_elements elements, invoking fn(element)
+     *  for each of them as soon as it is found. Returns false (without invoking fn) on failure. */
+    template<typename Fn>
+    bool DecodeCallback(size_t max_elements, Fn&& fn) const
+    {
+        ssize_t ret = minisketch_decode_callback(m_minisketch.get(), max_elements, [](uint64_t element, void* arg) {
+            (*static_cast<typename std::remove_reference<Fn>::type*>(arg))(element);
+        }, (void*)&fn);
+        return ret != -1;
+    }
+
+    /** Decode this (valid) Minisketch object into result, as GetElementSize() little-endian bytes per
+     *  element, up to as many elements as the vector's size permits. */
+    bool DecodeBytes(std::vector<unsigned char>& result) const
+    {
+        size_t element_size = GetElementSize();
+        ssize_t ret = minisketch_decode_bytes(m_minisketch.get(), result.size() / element_size, result.data());
+        if (ret == -1) return false;
+        result.resize(ret * element_size);
+        return true;
+    }
+
     /** Get the serialized size in bytes for this (valid) Minisketch object.. */
     size_t GetSerializedSize() const noexcept { return minisketch_serialized_size(m_minisketch.get()); }
 
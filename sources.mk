@@ -14,6 +14,7 @@ MINISKETCH_DIST_HEADERS_INT =
 MINISKETCH_DIST_HEADERS_INT += %reldir%/include/minisketch.h
 
 MINISKETCH_LIB_HEADERS_INT =
+MINISKETCH_LIB_HEADERS_INT += %reldir%/src/decode_cache.h
 MINISKETCH_LIB_HEADERS_INT += %reldir%/src/false_positives.h
 MINISKETCH_LIB_HEADERS_INT += %reldir%/src/fielddefines.h
 MINISKETCH_LIB_HEADERS_INT += %reldir%/src/int_utils.h
@@ -27,6 +28,8 @@ MINISKETCH_LIB_SOURCES_INT += %reldir%/src/minisketch.cpp
 
 MINISKETCH_FIELD_GENERIC_HEADERS_INT =
 MINISKETCH_FIELD_GENERIC_HEADERS_INT += %reldir%/src/fields/generic_common_impl.h
+MINISKETCH_FIELD_GENERIC_HEADERS_INT += %reldir%/src/fields/tower_common_impl.h
+MINISKETCH_FIELD_GENERIC_HEADERS_INT += %reldir%/src/fields/wide_common_impl.h
 
 MINISKETCH_FIELD_GENERIC_SOURCES_INT =
 MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_1byte.cpp
@@ -37,6 +40,15 @@ MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_5bytes.cpp
 MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_6bytes.cpp
 MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_7bytes.cpp
 MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_8bytes.cpp
+MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_9bytes.cpp
+MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_10bytes.cpp
+MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_11bytes.cpp
+MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_12bytes.cpp
+MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_13bytes.cpp
+MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_14bytes.cpp
+MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_15bytes.cpp
+MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/generic_16bytes.cpp
+MINISKETCH_FIELD_GENERIC_SOURCES_INT += %reldir%/src/fields/tower.cpp
 
 MINISKETCH_FIELD_CLMUL_HEADERS_INT =
 MINISKETCH_FIELD_CLMUL_HEADERS_INT += %reldir%/src/fields/clmul_common_impl.h
@@ -50,6 +62,17 @@ MINISKETCH_FIELD_CLMUL_SOURCES_INT += %reldir%/src/fields/clmul_5bytes.cpp
 MINISKETCH_FIELD_CLMUL_SOURCES_INT += %reldir%/src/fields/clmul_6bytes.cpp
 MINISKETCH_FIELD_CLMUL_SOURCES_INT += %reldir%/src/fields/clmul_7bytes.cpp
 MINISKETCH_FIELD_CLMUL_SOURCES_INT += %reldir%/src/fields/clmul_8bytes.cpp
+MINISKETCH_FIELD_CLMUL_SOURCES_INT += %reldir%/src/fields/clmul_9bytes.cpp
+MINISKETCH_FIELD_CLMUL_SOURCES_INT += %reldir%/src/fields/clmul_10bytes.cpp
+MINISKETCH_FIELD_CLMUL_SOURCES_INT += %reldir%/src/fields/clmul_11bytes.cpp
+MINISKETCH_FIELD_CLMUL_SOURCES_INT += %reldir%/src/fields/clmul_12bytes.cpp
+MINISKETCH_FIELD_CLMUL_SOURCES_INT += %reldir%/src/fields/clmul_13bytes.cpp
+MINISKETCH_FIELD_CLMUL_SOURCES_INT += %reldir%/src/fields/clmul_14bytes.cpp
+MINISKETCH_FIELD_CLMUL_SOURCES_INT += %reldir%/src/fields/clmul_15bytes.cpp
+MINISKETCH_FIELD_CLMUL_SOURCES_INT += %reldir%/src/fields/clmul_16bytes.cpp
+
+MINISKETCH_FIELD_SSSE3_SOURCES_INT =
+MINISKETCH_FIELD_SSSE3_SOURCES_INT += %reldir%/src/fields/generic_ssse3.cpp
 
 MINISKETCH_BENCH_SOURCES_INT =
 MINISKETCH_BENCH_SOURCES_INT += %reldir%/src/bench.cpp
@@ -113,6 +113,33 @@ int main(int argc, char** argv) {
             }
         }
         printf("\n");
+        printf("new[ns]\t\t% 3i\t", bits);
+        for (uint32_t impl = 0; impl <= max_impl; ++impl) {
+            static constexpr int BATCH = 100;
+            std::vector<minisketch*> states(BATCH);
+            std::vector<double> benches;
+            benches.reserve(iters);
+            bool supported = minisketch_implementation_supported(bits, impl);
+            for (int i = 0; supported && i < iters; ++i) {
+                auto start = std::chrono::steady_clock::now();
+                for (auto& state : states) {
+                    state = minisketch_create(bits, impl, syndromes);
+                }
+                for (auto& state : states) {
+                    minisketch_destroy(state);
+                }
+                auto stop = std::chrono::steady_clock::now();
+                std::chrono::duration<double> dur(stop - start);
+                benches.push_back(dur.count());
+            }
+            if (benches.empty()) {
+                printf("         -\t");
+            } else {
+                std::sort(benches.begin(), benches.end());
+                printf("% 10.5f\t", benches[0] * 1000000000.0 / BATCH);
+            }
+        }
+        printf("\n");
     }
     return 0;
 }
@@ -0,0 +1,178 @@
+/**********************************************************************
+ * Copyright (c) 2026 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef _MINISKETCH_DECODE_CACHE_H_
+#define _MINISKETCH_DECODE_CACHE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "int_utils.h"
+#include "sketch.h"
+
+/** A bounded, thread-safe LRU cache of decoding results.
+ *
+ * Entries are keyed by field size, implementation, capacity, and the contents of a
+ * sketch. Lookups go through a SipHash of those, but contents are compared in full,
+ * so hash collisions can only cause misses.
+ */
+class DecodeCache
+{
+public:
+    struct Key
+    {
+        int bits;
+        int implementation;
+        size_t capacity;
+        std::vector<unsigned char> serialized;
+        uint64_t hash;
+    };
+
+private:
+    struct Entry
+    {
+        Key key;
+        //! Whether decoding succeeded.
+        bool success;
+        //! If success, the decoded elements.
+        std::vector<uint64_t> elements;
+        //! If not success, the largest max_elements for which decoding is known to fail.
+        size_t fail_max;
+    };
+
+    std::atomic<size_t> m_max_entries{0};
+    std::mutex m_mutex;
+    std::list<Entry> m_entries; //!< Most recently used first.
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> m_index;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+    uint64_t m_k0, m_k1;
+
+    static bool Matches(const Key& a, const Key& b)
+    {
+        return a.bits == b.bits && a.implementation == b.implementation && a.capacity == b.capacity && a.serialized == b.serialized;
+    }
+
+public:
+    DecodeCache()
+    {
+        std::random_device rng;
+        std::uniform_int_distribution<uint64_t> dist;
+        m_k0 = dist(rng);
+        m_k1 = dist(rng);
+    }
+
+    /** Whether the cache is enabled. */
+    bool Enabled() const { return m_max_entries.load(std::memory_order_relaxed) != 0; }
+
+    /** Set the maximum number of entries (0 to disable the cache). Clears the cache and its statistics. */
+    void Configure(size_t max_entries)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+        m_index.clear();
+        m_hits = 0;
+        m_misses = 0;
+        m_max_entries.store(max_entries, std::memory_order_relaxed);
+    }
+
+    /** Get the number of lookups that were and were not answered from the cache. */
+    void Stats(uint64_t& hits, uint64_t& misses)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        hits = m_hits;
+        misses = m_misses;
+    }
+
+    /** Compute the cache key for a sketch. */
+    Key MakeKey(const Sketch* sketch) const
+    {
+        Key key;
+        key.bits = sketch->Bits();
+        key.implementation = sketch->Implementation();
+        key.capacity = sketch->Syndromes();
+        key.serialized.resize((key.bits * key.capacity + 7) / 8);
+        sketch->Serialize(key.serialized.data());
+        uint64_t hash = SipHash(m_k0, m_k1, (uint64_t(key.bits) << 32) | uint64_t(key.implementation));
+        hash = SipHash(m_k0 ^ hash, m_k1, key.capacity);
+        for (size_t pos = 0; pos < key.serialized.size(); pos += 8) {
+            unsigned char buf[8] = {0};
+            memcpy(buf, key.serialized.data() + pos, std::min<size_t>(8, key.serialized.size() - pos));
+            uint64_t word = 0;
+            for (int i = 0; i < 8; ++i) word |= uint64_t(buf[i]) << (8 * i);
+            hash = SipHash(m_k0 ^ hash, m_k1, word);
+        }
+        key.hash = hash;
+        return key;
+    }
+
+    /** Look up the result of decoding with up to max_elements elements.
+     *
+     * Returns false if it is unknown. Otherwise, result is set to -1 if decoding fails, or to
+     * the number of elements, which are copied to elements.
+     */
+    bool Lookup(const Key& key, size_t max_elements, int& result, std::vector<uint64_t>& elements)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_index.find(key.hash);
+        if (it != m_index.end() && Matches(it->second->key, key)) {
+            const Entry& entry = *it->second;
+            if (entry.success) {
+                if (entry.elements.size() > max_elements) {
+                    result = -1;
+                } else {
+                    result = entry.elements.size();
+                    elements = entry.elements;
+                }
+                ++m_hits;
+                m_entries.splice(m_entries.begin(), m_entries, it->second);
+                return true;
+            } else if (max_elements <= entry.fail_max) {
+                result = -1;
+                ++m_hits;
+                m_entries.splice(m_entries.begin(), m_entries, it->second);
+                return true;
+            }
+        }
+        ++m_misses;
+        return false;
+    }
+
+    /** Store the result of decoding with up to max_elements elements (-1 for failure). */
+    void Insert(Key&& key, size_t max_elements, int result, const uint64_t* elements)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t max_entries = m_max_entries.load(std::memory_order_relaxed);
+        if (max_entries == 0) return;
+        auto it = m_index.find(key.hash);
+        if (it != m_index.end()) {
+            m_entries.erase(it->second);
+            m_index.erase(it);
+        }
+        Entry entry;
+        entry.success = result >= 0;
+        if (entry.success) entry.elements.assign(elements, elements + result);
+        entry.fail_max = max_elements;
+        uint64_t hash = key.hash;
+        entry.key = std::move(key);
+        m_entries.push_front(std::move(entry));
+        m_index.emplace(hash, m_entries.begin());
+        while (m_entries.size() > max_entries) {
+            m_index.erase(m_entries.back().key.hash);
+            m_entries.pop_back();
+        }
+    }
+};
+
+#endif
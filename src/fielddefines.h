@@ -213,6 +213,198 @@ Default: All fields enabled
 #if defined(ENABLE_FIELD_64) && !defined(DISABLE_FIELD_64)
 #define ENABLE_FIELD_INT_64
 #endif
+#if defined(ENABLE_FIELD_65) && !defined(DISABLE_FIELD_65)
+#define ENABLE_FIELD_INT_65
+#endif
+#if defined(ENABLE_FIELD_66) && !defined(DISABLE_FIELD_66)
+#define ENABLE_FIELD_INT_66
+#endif
+#if defined(ENABLE_FIELD_67) && !defined(DISABLE_FIELD_67)
+#define ENABLE_FIELD_INT_67
+#endif
+#if defined(ENABLE_FIELD_68) && !defined(DISABLE_FIELD_68)
+#define ENABLE_FIELD_INT_68
+#endif
+#if defined(ENABLE_FIELD_69) && !defined(DISABLE_FIELD_69)
+#define ENABLE_FIELD_INT_69
+#endif
+#if defined(ENABLE_FIELD_70) && !defined(DISABLE_FIELD_70)
+#define ENABLE_FIELD_INT_70
+#endif
+#if defined(ENABLE_FIELD_71) && !defined(DISABLE_FIELD_71)
+#define ENABLE_FIELD_INT_71
+#endif
+#if defined(ENABLE_FIELD_72) && !defined(DISABLE_FIELD_72)
+#define ENABLE_FIELD_INT_72
+#endif
+#if defined(ENABLE_FIELD_73) && !defined(DISABLE_FIELD_73)
+#define ENABLE_FIELD_INT_73
+#endif
+#if defined(ENABLE_FIELD_74) && !defined(DISABLE_FIELD_74)
+#define ENABLE_FIELD_INT_74
+#endif
+#if defined(ENABLE_FIELD_75) && !defined(DISABLE_FIELD_75)
+#define ENABLE_FIELD_INT_75
+#endif
+#if defined(ENABLE_FIELD_76) && !defined(DISABLE_FIELD_76)
+#define ENABLE_FIELD_INT_76
+#endif
+#if defined(ENABLE_FIELD_77) && !defined(DISABLE_FIELD_77)
+#define ENABLE_FIELD_INT_77
+#endif
+#if defined(ENABLE_FIELD_78) && !defined(DISABLE_FIELD_78)
+#define ENABLE_FIELD_INT_78
+#endif
+#if defined(ENABLE_FIELD_79) && !defined(DISABLE_FIELD_79)
+#define ENABLE_FIELD_INT_79
+#endif
+#if defined(ENABLE_FIELD_80) && !defined(DISABLE_FIELD_80)
+#define ENABLE_FIELD_INT_80
+#endif
+#if defined(ENABLE_FIELD_81) && !defined(DISABLE_FIELD_81)
+#define ENABLE_FIELD_INT_81
+#endif
+#if defined(ENABLE_FIELD_82) && !defined(DISABLE_FIELD_82)
+#define ENABLE_FIELD_INT_82
+#endif
+#if defined(ENABLE_FIELD_83) && !defined(DISABLE_FIELD_83)
+#define ENABLE_FIELD_INT_83
+#endif
+#if defined(ENABLE_FIELD_84) && !defined(DISABLE_FIELD_84)
+#define ENABLE_FIELD_INT_84
+#endif
+#if defined(ENABLE_FIELD_85) && !defined(DISABLE_FIELD_85)
+#define ENABLE_FIELD_INT_85
+#endif
+#if defined(ENABLE_FIELD_86) && !defined(DISABLE_FIELD_86)
+#define ENABLE_FIELD_INT_86
+#endif
+#if defined(ENABLE_FIELD_87) && !defined(DISABLE_FIELD_87)
+#define ENABLE_FIELD_INT_87
+#endif
+#if defined(ENABLE_FIELD_88) && !defined(DISABLE_FIELD_88)
+#define ENABLE_FIELD_INT_88
+#endif
+#if defined(ENABLE_FIELD_89) && !defined(DISABLE_FIELD_89)
+#define ENABLE_FIELD_INT_89
+#endif
+#if defined(ENABLE_FIELD_90) && !defined(DISABLE_FIELD_90)
+#define ENABLE_FIELD_INT_90
+#endif
+#if defined(ENABLE_FIELD_91) && !defined(DISABLE_FIELD_91)
+#define ENABLE_FIELD_INT_91
+#endif
+#if defined(ENABLE_FIELD_92) && !defined(DISABLE_FIELD_92)
+#define ENABLE_FIELD_INT_92
+#endif
+#if defined(ENABLE_FIELD_93) && !defined(DISABLE_FIELD_93)
+#define ENABLE_FIELD_INT_93
+#endif
+#if defined(ENABLE_FIELD_94) && !defined(DISABLE_FIELD_94)
+#define ENABLE_FIELD_INT_94
+#endif
+#if defined(ENABLE_FIELD_95) && !defined(DISABLE_FIELD_95)
+#define ENABLE_FIELD_INT_95
+#endif
+#if defined(ENABLE_FIELD_96) && !defined(DISABLE_FIELD_96)
+#define ENABLE_FIELD_INT_96
+#endif
+#if defined(ENABLE_FIELD_97) && !defined(DISABLE_FIELD_97)
+#define ENABLE_FIELD_INT_97
+#endif
+#if defined(ENABLE_FIELD_98) && !defined(DISABLE_FIELD_98)
+#define ENABLE_FIELD_INT_98
+#endif
+#if defined(ENABLE_FIELD_99) && !defined(DISABLE_FIELD_99)
+#define ENABLE_FIELD_INT_99
+#endif
+#if defined(ENABLE_FIELD_100) && !defined(DISABLE_FIELD_100)
+#define ENABLE_FIELD_INT_100
+#endif
+#if defined(ENABLE_FIELD_101) && !defined(DISABLE_FIELD_101)
+#define ENABLE_FIELD_INT_101
+#endif
+#if defined(ENABLE_FIELD_102) && !defined(DISABLE_FIELD_102)
+#define ENABLE_FIELD_INT_102
+#endif
+#if defined(ENABLE_FIELD_103) && !defined(DISABLE_FIELD_103)
+#define ENABLE_FIELD_INT_103
+#endif
+#if defined(ENABLE_FIELD_104) && !defined(DISABLE_FIELD_104)
+#define ENABLE_FIELD_INT_104
+#endif
+#if defined(ENABLE_FIELD_105) && !defined(DISABLE_FIELD_105)
+#define ENABLE_FIELD_INT_105
+#endif
+#if defined(ENABLE_FIELD_106) && !defined(DISABLE_FIELD_106)
+#define ENABLE_FIELD_INT_106
+#endif
+#if defined(ENABLE_FIELD_107) && !defined(DISABLE_FIELD_107)
+#define ENABLE_FIELD_INT_107
+#endif
+#if defined(ENABLE_FIELD_108) && !defined(DISABLE_FIELD_108)
+#define ENABLE_FIELD_INT_108
+#endif
+#if defined(ENABLE_FIELD_109) && !defined(DISABLE_FIELD_109)
+#define ENABLE_FIELD_INT_109
+#endif
+#if defined(ENABLE_FIELD_110) && !defined(DISABLE_FIELD_110)
+#define ENABLE_FIELD_INT_110
+#endif
+#if defined(ENABLE_FIELD_111) && !defined(DISABLE_FIELD_111)
+#define ENABLE_FIELD_INT_111
+#endif
+#if defined(ENABLE_FIELD_112) && !defined(DISABLE_FIELD_112)
+#define ENABLE_FIELD_INT_112
+#endif
+#if defined(ENABLE_FIELD_113) && !defined(DISABLE_FIELD_113)
+#define ENABLE_FIELD_INT_113
+#endif
+#if defined(ENABLE_FIELD_114) && !defined(DISABLE_FIELD_114)
+#define ENABLE_FIELD_INT_114
+#endif
+#if defined(ENABLE_FIELD_115) && !defined(DISABLE_FIELD_115)
+#define ENABLE_FIELD_INT_115
+#endif
+#if defined(ENABLE_FIELD_116) && !defined(DISABLE_FIELD_116)
+#define ENABLE_FIELD_INT_116
+#endif
+#if defined(ENABLE_FIELD_117) && !defined(DISABLE_FIELD_117)
+#define ENABLE_FIELD_INT_117
+#endif
+#if defined(ENABLE_FIELD_118) && !defined(DISABLE_FIELD_118)
+#define ENABLE_FIELD_INT_118
+#endif
+#if defined(ENABLE_FIELD_119) && !defined(DISABLE_FIELD_119)
+#define ENABLE_FIELD_INT_119
+#endif
+#if defined(ENABLE_FIELD_120) && !defined(DISABLE_FIELD_120)
+#define ENABLE_FIELD_INT_120
+#endif
+#if defined(ENABLE_FIELD_121) && !defined(DISABLE_FIELD_121)
+#define ENABLE_FIELD_INT_121
+#endif
+#if defined(ENABLE_FIELD_122) && !defined(DISABLE_FIELD_122)
+#define ENABLE_FIELD_INT_122
+#endif
+#if defined(ENABLE_FIELD_123) && !defined(DISABLE_FIELD_123)
+#define ENABLE_FIELD_INT_123
+#endif
+#if defined(ENABLE_FIELD_124) && !defined(DISABLE_FIELD_124)
+#define ENABLE_FIELD_INT_124
+#endif
+#if defined(ENABLE_FIELD_125) && !defined(DISABLE_FIELD_125)
+#define ENABLE_FIELD_INT_125
+#endif
+#if defined(ENABLE_FIELD_126) && !defined(DISABLE_FIELD_126)
+#define ENABLE_FIELD_INT_126
+#endif
+#if defined(ENABLE_FIELD_127) && !defined(DISABLE_FIELD_127)
+#define ENABLE_FIELD_INT_127
+#endif
+#if defined(ENABLE_FIELD_128) && !defined(DISABLE_FIELD_128)
+#define ENABLE_FIELD_INT_128
+#endif
 #else
 #if !defined(DISABLE_FIELD_2)
 #define ENABLE_FIELD_INT_2
@@ -403,6 +595,198 @@ Default: All fields enabled
 #if !defined(DISABLE_FIELD_64)
 #define ENABLE_FIELD_INT_64
 #endif
+#if !defined(DISABLE_FIELD_65)
+#define ENABLE_FIELD_INT_65
+#endif
+#if !defined(DISABLE_FIELD_66)
+#define ENABLE_FIELD_INT_66
+#endif
+#if !defined(DISABLE_FIELD_67)
+#define ENABLE_FIELD_INT_67
+#endif
+#if !defined(DISABLE_FIELD_68)
+#define ENABLE_FIELD_INT_68
+#endif
+#if !defined(DISABLE_FIELD_69)
+#define ENABLE_FIELD_INT_69
+#endif
+#if !defined(DISABLE_FIELD_70)
+#define ENABLE_FIELD_INT_70
+#endif
+#if !defined(DISABLE_FIELD_71)
+#define ENABLE_FIELD_INT_71
+#endif
+#if !defined(DISABLE_FIELD_72)
+#define ENABLE_FIELD_INT_72
+#endif
+#if !defined(DISABLE_FIELD_73)
+#define ENABLE_FIELD_INT_73
+#endif
+#if !defined(DISABLE_FIELD_74)
+#define ENABLE_FIELD_INT_74
+#endif
+#if !defined(DISABLE_FIELD_75)
+#define ENABLE_FIELD_INT_75
+#endif
+#if !defined(DISABLE_FIELD_76)
+#define ENABLE_FIELD_INT_76
+#endif
+#if !defined(DISABLE_FIELD_77)
+#define ENABLE_FIELD_INT_77
+#endif
+#if !defined(DISABLE_FIELD_78)
+#define ENABLE_FIELD_INT_78
+#endif
+#if !defined(DISABLE_FIELD_79)
+#define ENABLE_FIELD_INT_79
+#endif
+#if !defined(DISABLE_FIELD_80)
+#define ENABLE_FIELD_INT_80
+#endif
+#if !defined(DISABLE_FIELD_81)
+#define ENABLE_FIELD_INT_81
+#endif
+#if !defined(DISABLE_FIELD_82)
+#define ENABLE_FIELD_INT_82
+#endif
+#if !defined(DISABLE_FIELD_83)
+#define ENABLE_FIELD_INT_83
+#endif
+#if !defined(DISABLE_FIELD_84)
+#define ENABLE_FIELD_INT_84
+#endif
+#if !defined(DISABLE_FIELD_85)
+#define ENABLE_FIELD_INT_85
+#endif
+#if !defined(DISABLE_FIELD_86)
+#define ENABLE_FIELD_INT_86
+#endif
+#if !defined(DISABLE_FIELD_87)
+#define ENABLE_FIELD_INT_87
+#endif
+#if !defined(DISABLE_FIELD_88)
+#define ENABLE_FIELD_INT_88
+#endif
+#if !defined(DISABLE_FIELD_89)
+#define ENABLE_FIELD_INT_89
+#endif
+#if !defined(DISABLE_FIELD_90)
+#define ENABLE_FIELD_INT_90
+#endif
+#if !defined(DISABLE_FIELD_91)
+#define ENABLE_FIELD_INT_91
+#endif
+#if !defined(DISABLE_FIELD_92)
+#define ENABLE_FIELD_INT_92
+#endif
+#if !defined(DISABLE_FIELD_93)
+#define ENABLE_FIELD_INT_93
+#endif
+#if !defined(DISABLE_FIELD_94)
+#define ENABLE_FIELD_INT_94
+#endif
+#if !defined(DISABLE_FIELD_95)
+#define ENABLE_FIELD_INT_95
+#endif
+#if !defined(DISABLE_FIELD_96)
+#define ENABLE_FIELD_INT_96
+#endif
+#if !defined(DISABLE_FIELD_97)
+#define ENABLE_FIELD_INT_97
+#endif
+#if !defined(DISABLE_FIELD_98)
+#define ENABLE_FIELD_INT_98
+#endif
+#if !defined(DISABLE_FIELD_99)
+#define ENABLE_FIELD_INT_99
+#endif
+#if !defined(DISABLE_FIELD_100)
+#define ENABLE_FIELD_INT_100
+#endif
+#if !defined(DISABLE_FIELD_101)
+#define ENABLE_FIELD_INT_101
+#endif
+#if !defined(DISABLE_FIELD_102)
+#define ENABLE_FIELD_INT_102
+#endif
+#if !defined(DISABLE_FIELD_103)
+#define ENABLE_FIELD_INT_103
+#endif
+#if !defined(DISABLE_FIELD_104)
+#define ENABLE_FIELD_INT_104
+#endif
+#if !defined(DISABLE_FIELD_105)
+#define ENABLE_FIELD_INT_105
+#endif
+#if !defined(DISABLE_FIELD_106)
+#define ENABLE_FIELD_INT_106
+#endif
+#if !defined(DISABLE_FIELD_107)
+#define ENABLE_FIELD_INT_107
+#endif
+#if !defined(DISABLE_FIELD_108)
+#define ENABLE_FIELD_INT_108
+#endif
+#if !defined(DISABLE_FIELD_109)
+#define ENABLE_FIELD_INT_109
+#endif
+#if !defined(DISABLE_FIELD_110)
+#define ENABLE_FIELD_INT_110
+#endif
+#if !defined(DISABLE_FIELD_111)
+#define ENABLE_FIELD_INT_111
+#endif
+#if !defined(DISABLE_FIELD_112)
+#define ENABLE_FIELD_INT_112
+#endif
+#if !defined(DISABLE_FIELD_113)
+#define ENABLE_FIELD_INT_113
+#endif
+#if !defined(DISABLE_FIELD_114)
+#define ENABLE_FIELD_INT_114
+#endif
+#if !defined(DISABLE_FIELD_115)
+#define ENABLE_FIELD_INT_115
+#endif
+#if !defined(DISABLE_FIELD_116)
+#define ENABLE_FIELD_INT_116
+#endif
+#if !defined(DISABLE_FIELD_117)
+#define ENABLE_FIELD_INT_117
+#endif
+#if !defined(DISABLE_FIELD_118)
+#define ENABLE_FIELD_INT_118
+#endif
+#if !defined(DISABLE_FIELD_119)
+#define ENABLE_FIELD_INT_119
+#endif
+#if !defined(DISABLE_FIELD_120)
+#define ENABLE_FIELD_INT_120
+#endif
+#if !defined(DISABLE_FIELD_121)
+#define ENABLE_FIELD_INT_121
+#endif
+#if !defined(DISABLE_FIELD_122)
+#define ENABLE_FIELD_INT_122
+#endif
+#if !defined(DISABLE_FIELD_123)
+#define ENABLE_FIELD_INT_123
+#endif
+#if !defined(DISABLE_FIELD_124)
+#define ENABLE_FIELD_INT_124
+#endif
+#if !defined(DISABLE_FIELD_125)
+#define ENABLE_FIELD_INT_125
+#endif
+#if !defined(DISABLE_FIELD_126)
+#define ENABLE_FIELD_INT_126
+#endif
+#if !defined(DISABLE_FIELD_127)
+#define ENABLE_FIELD_INT_127
+#endif
+#if !defined(DISABLE_FIELD_128)
+#define ENABLE_FIELD_INT_128
+#endif
 #endif
 
 #if !defined(ENABLE_FIELD_INT_2) && \
@@ -467,7 +851,71 @@ Default: All fields enabled
     !defined(ENABLE_FIELD_INT_61) && \
     !defined(ENABLE_FIELD_INT_62) && \
     !defined(ENABLE_FIELD_INT_63) && \
-    !defined(ENABLE_FIELD_INT_64)
+    !defined(ENABLE_FIELD_INT_64) && \
+    !defined(ENABLE_FIELD_INT_65) && \
+    !defined(ENABLE_FIELD_INT_66) && \
+    !defined(ENABLE_FIELD_INT_67) && \
+    !defined(ENABLE_FIELD_INT_68) && \
+    !defined(ENABLE_FIELD_INT_69) && \
+    !defined(ENABLE_FIELD_INT_70) && \
+    !defined(ENABLE_FIELD_INT_71) && \
+    !defined(ENABLE_FIELD_INT_72) && \
+    !defined(ENABLE_FIELD_INT_73) && \
+    !defined(ENABLE_FIELD_INT_74) && \
+    !defined(ENABLE_FIELD_INT_75) && \
+    !defined(ENABLE_FIELD_INT_76) && \
+    !defined(ENABLE_FIELD_INT_77) && \
+    !defined(ENABLE_FIELD_INT_78) && \
+    !defined(ENABLE_FIELD_INT_79) && \
+    !defined(ENABLE_FIELD_INT_80) && \
+    !defined(ENABLE_FIELD_INT_81) && \
+    !defined(ENABLE_FIELD_INT_82) && \
+    !defined(ENABLE_FIELD_INT_83) && \
+    !defined(ENABLE_FIELD_INT_84) && \
+    !defined(ENABLE_FIELD_INT_85) && \
+    !defined(ENABLE_FIELD_INT_86) && \
+    !defined(ENABLE_FIELD_INT_87) && \
+    !defined(ENABLE_FIELD_INT_88) && \
+    !defined(ENABLE_FIELD_INT_89) && \
+    !defined(ENABLE_FIELD_INT_90) && \
+    !defined(ENABLE_FIELD_INT_91) && \
+    !defined(ENABLE_FIELD_INT_92) && \
+    !defined(ENABLE_FIELD_INT_93) && \
+    !defined(ENABLE_FIELD_INT_94) && \
+    !defined(ENABLE_FIELD_INT_95) && \
+    !defined(ENABLE_FIELD_INT_96) && \
+    !defined(ENABLE_FIELD_INT_97) && \
+    !defined(ENABLE_FIELD_INT_98) && \
+    !defined(ENABLE_FIELD_INT_99) && \
+    !defined(ENABLE_FIELD_INT_100) && \
+    !defined(ENABLE_FIELD_INT_101) && \
+    !defined(ENABLE_FIELD_INT_102) && \
+    !defined(ENABLE_FIELD_INT_103) && \
+    !defined(ENABLE_FIELD_INT_104) && \
+    !defined(ENABLE_FIELD_INT_105) && \
+    !defined(ENABLE_FIELD_INT_106) && \
+    !defined(ENABLE_FIELD_INT_107) && \
+    !defined(ENABLE_FIELD_INT_108) && \
+    !defined(ENABLE_FIELD_INT_109) && \
+    !defined(ENABLE_FIELD_INT_110) && \
+    !defined(ENABLE_FIELD_INT_111) && \
+    !defined(ENABLE_FIELD_INT_112) && \
+    !defined(ENABLE_FIELD_INT_113) && \
+    !defined(ENABLE_FIELD_INT_114) && \
+    !defined(ENABLE_FIELD_INT_115) && \
+    !defined(ENABLE_FIELD_INT_116) && \
+    !defined(ENABLE_FIELD_INT_117) && \
+    !defined(ENABLE_FIELD_INT_118) && \
+    !defined(ENABLE_FIELD_INT_119) && \
+    !defined(ENABLE_FIELD_INT_120) && \
+    !defined(ENABLE_FIELD_INT_121) && \
+    !defined(ENABLE_FIELD_INT_122) && \
+    !defined(ENABLE_FIELD_INT_123) && \
+    !defined(ENABLE_FIELD_INT_124) && \
+    !defined(ENABLE_FIELD_INT_125) && \
+    !defined(ENABLE_FIELD_INT_126) && \
+    !defined(ENABLE_FIELD_INT_127) && \
+    !defined(ENABLE_FIELD_INT_128)
 #error No fields enabled
 #endif
 
@@ -557,4 +1005,92 @@ Default: All fields enabled
     defined(ENABLE_FIELD_INT_64)
 #define ENABLE_FIELD_BYTES_INT_8
 #endif
+
+#if defined(ENABLE_FIELD_INT_65) || \
+    defined(ENABLE_FIELD_INT_66) || \
+    defined(ENABLE_FIELD_INT_67) || \
+    defined(ENABLE_FIELD_INT_68) || \
+    defined(ENABLE_FIELD_INT_69) || \
+    defined(ENABLE_FIELD_INT_70) || \
+    defined(ENABLE_FIELD_INT_71) || \
+    defined(ENABLE_FIELD_INT_72)
+#define ENABLE_FIELD_BYTES_INT_9
+#endif
+
+#if defined(ENABLE_FIELD_INT_73) || \
+    defined(ENABLE_FIELD_INT_74) || \
+    defined(ENABLE_FIELD_INT_75) || \
+    defined(ENABLE_FIELD_INT_76) || \
+    defined(ENABLE_FIELD_INT_77) || \
+    defined(ENABLE_FIELD_INT_78) || \
+    defined(ENABLE_FIELD_INT_79) || \
+    defined(ENABLE_FIELD_INT_80)
+#define ENABLE_FIELD_BYTES_INT_10
+#endif
+
+#if defined(ENABLE_FIELD_INT_81) || \
+    defined(ENABLE_FIELD_INT_82) || \
+    defined(ENABLE_FIELD_INT_83) || \
+    defined(ENABLE_FIELD_INT_84) || \
+    defined(ENABLE_FIELD_INT_85) || \
+    defined(ENABLE_FIELD_INT_86) || \
+    defined(ENABLE_FIELD_INT_87) || \
+    defined(ENABLE_FIELD_INT_88)
+#define ENABLE_FIELD_BYTES_INT_11
+#endif
+
+#if defined(ENABLE_FIELD_INT_89) || \
+    defined(ENABLE_FIELD_INT_90) || \
+    defined(ENABLE_FIELD_INT_91) || \
+    defined(ENABLE_FIELD_INT_92) || \
+    defined(ENABLE_FIELD_INT_93) || \
+    defined(ENABLE_FIELD_INT_94) || \
+    defined(ENABLE_FIELD_INT_95) || \
+    defined(ENABLE_FIELD_INT_96)
+#define ENABLE_FIELD_BYTES_INT_12
+#endif
+
+#if defined(ENABLE_FIELD_INT_97) || \
+    defined(ENABLE_FIELD_INT_98) || \
+    defined(ENABLE_FIELD_INT_99) || \
+    defined(ENABLE_FIELD_INT_100) || \
+    defined(ENABLE_FIELD_INT_101) || \
+    defined(ENABLE_FIELD_INT_102) || \
+    defined(ENABLE_FIELD_INT_103) || \
+    defined(ENABLE_FIELD_INT_104)
+#define ENABLE_FIELD_BYTES_INT_13
+#endif
+
+#if defined(ENABLE_FIELD_INT_105) || \
+    defined(ENABLE_FIELD_INT_106) || \
+    defined(ENABLE_FIELD_INT_107) || \
+    defined(ENABLE_FIELD_INT_108) || \
+    defined(ENABLE_FIELD_INT_109) || \
+    defined(ENABLE_FIELD_INT_110) || \
+    defined(ENABLE_FIELD_INT_111) || \
+    defined(ENABLE_FIELD_INT_112)
+#define ENABLE_FIELD_BYTES_INT_14
+#endif
+
+#if defined(ENABLE_FIELD_INT_113) || \
+    defined(ENABLE_FIELD_INT_114) || \
+    defined(ENABLE_FIELD_INT_115) || \
+    defined(ENABLE_FIELD_INT_116) || \
+    defined(ENABLE_FIELD_INT_117) || \
+    defined(ENABLE_FIELD_INT_118) || \
+    defined(ENABLE_FIELD_INT_119) || \
+    defined(ENABLE_FIELD_INT_120)
+#define ENABLE_FIELD_BYTES_INT_15
+#endif
+
+#if defined(ENABLE_FIELD_INT_121) || \
+    defined(ENABLE_FIELD_INT_122) || \
+    defined(ENABLE_FIELD_INT_123) || \
+    defined(ENABLE_FIELD_INT_124) || \
+    defined(ENABLE_FIELD_INT_125) || \
+    defined(ENABLE_FIELD_INT_126) || \
+    defined(ENABLE_FIELD_INT_127) || \
+    defined(ENABLE_FIELD_INT_128)
+#define ENABLE_FIELD_BYTES_INT_16
+#endif
 #endif // _MINISKETCH_FIELDDEFINES_H_
@@ -0,0 +1,90 @@
+/**********************************************************************
+ * Copyright (c) 2018 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#include "../fielddefines.h"
+
+#if defined(ENABLE_FIELD_BYTES_INT_12)
+
+#include "clmul_common_impl.h"
+#include "wide_common_impl.h"
+#include "../sketch_impl.h"
+
+#endif
+
+#include "../sketch.h"
+
+namespace {
+#ifdef ENABLE_FIELD_INT_89
+// 89 bit field
+typedef WideField<89, 0x4000000001, WideClMul> Field89;
+#endif
+
+#ifdef ENABLE_FIELD_INT_90
+// 90 bit field
+typedef WideField<90, 0x8000001, WideClMul> Field90;
+#endif
+
+#ifdef ENABLE_FIELD_INT_91
+// 91 bit field
+typedef WideField<91, 0x123, WideClMul> Field91;
+#endif
+
+#ifdef ENABLE_FIELD_INT_92
+// 92 bit field
+typedef WideField<92, 0x200001, WideClMul> Field92;
+#endif
+
+#ifdef ENABLE_FIELD_INT_93
+// 93 bit field
+typedef WideField<93, 0x5, WideClMul> Field93;
+#endif
+
+#ifdef ENABLE_FIELD_INT_94
+// 94 bit field
+typedef WideField<94, 0x200001, WideClMul> Field94;
+#endif
+
+#ifdef ENABLE_FIELD_INT_95
+// 95 bit field
+typedef WideField<95, 0x801, WideClMul> Field95;
+#endif
+
+#ifdef ENABLE_FIELD_INT_96
+// 96 bit field
+typedef WideField<96, 0x641, WideClMul> Field96;
+#endif
+}
+
+Sketch* ConstructClMul12Bytes(int bits, int implementation)
+{
+    switch (bits) {
+#ifdef ENABLE_FIELD_INT_89
+    case 89: return new SketchImpl<Field89>(implementation, 89);
+#endif
+#ifdef ENABLE_FIELD_INT_90
+    case 90: return new SketchImpl<Field90>(implementation, 90);
+#endif
+#ifdef ENABLE_FIELD_INT_91
+    case 91: return new SketchImpl<Field91>(implementation, 91);
+#endif
+#ifdef ENABLE_FIELD_INT_92
+    case 92: return new SketchImpl<Field92>(implementation, 92);
+#endif
+#ifdef ENABLE_FIELD_INT_93
+    case 93: return new SketchImpl<Field93>(implementation, 93);
+#endif
+#ifdef ENABLE_FIELD_INT_94
+    case 94: return new SketchImpl<Field94>(implementation, 94);
+#endif
+#ifdef ENABLE_FIELD_INT_95
+    case 95: return new SketchImpl<Field95>(implementation, 95);
+#endif
+#ifdef ENABLE_FIELD_INT_96
+    case 96: return new SketchImpl<Field96>(implementation, 96);
+#endif
+    default: return nullptr;
+    }
+}
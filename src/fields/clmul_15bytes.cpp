@@ -0,0 +1,90 @@
+/**********************************************************************
+ * Copyright (c) 2018 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#include "../fielddefines.h"
+
+#if defined(ENABLE_FIELD_BYTES_INT_15)
+
+#include "clmul_common_impl.h"
+#include "wide_common_impl.h"
+#include "../sketch_impl.h"
+
+#endif
+
+#include "../sketch.h"
+
+namespace {
+#ifdef ENABLE_FIELD_INT_113
+// 113 bit field
+typedef WideField<113, 0x201, WideClMul> Field113;
+#endif
+
+#ifdef ENABLE_FIELD_INT_114
+// 114 bit field
+typedef WideField<114, 0x2d, WideClMul> Field114;
+#endif
+
+#ifdef ENABLE_FIELD_INT_115
+// 115 bit field
+typedef WideField<115, 0x1a1, WideClMul> Field115;
+#endif
+
+#ifdef ENABLE_FIELD_INT_116
+// 116 bit field
+typedef WideField<116, 0x17, WideClMul> Field116;
+#endif
+
+#ifdef ENABLE_FIELD_INT_117
+// 117 bit field
+typedef WideField<117, 0x27, WideClMul> Field117;
+#endif
+
+#ifdef ENABLE_FIELD_INT_118
+// 118 bit field
+typedef WideField<118, 0x200000001, WideClMul> Field118;
+#endif
+
+#ifdef ENABLE_FIELD_INT_119
+// 119 bit field
+typedef WideField<119, 0x101, WideClMul> Field119;
+#endif
+
+#ifdef ENABLE_FIELD_INT_120
+// 120 bit field
+typedef WideField<120, 0x1b, WideClMul> Field120;
+#endif
+}
+
+Sketch* ConstructClMul15Bytes(int bits, int implementation)
+{
+    switch (bits) {
+#ifdef ENABLE_FIELD_INT_113
+    case 113: return new SketchImpl<Field113>(implementation, 113);
+#endif
+#ifdef ENABLE_FIELD_INT_114
+    case 114: return new SketchImpl<Field114>(implementation, 114);
+#endif
+#ifdef ENABLE_FIELD_INT_115
+    case 115: return new SketchImpl<Field115>(implementation, 115);
+#endif
+#ifdef ENABLE_FIELD_INT_116
+    case 116: return new SketchImpl<Field116>(implementation, 116);
+#endif
+#ifdef ENABLE_FIELD_INT_117
+    case 117: return new SketchImpl<Field117>(implementation, 117);
+#endif
+#ifdef ENABLE_FIELD_INT_118
+    case 118: return new SketchImpl<Field118>(implementation, 118);
+#endif
+#ifdef ENABLE_FIELD_INT_119
+    case 119: return new SketchImpl<Field119>(implementation, 119);
+#endif
+#ifdef ENABLE_FIELD_INT_120
+    case 120: return new SketchImpl<Field120>(implementation, 120);
+#endif
+    default: return nullptr;
+    }
+}
@@ -0,0 +1,90 @@
+/**********************************************************************
+ * Copyright (c) 2018 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#include "../fielddefines.h"
+
+#if defined(ENABLE_FIELD_BYTES_INT_16)
+
+#include "clmul_common_impl.h"
+#include "wide_common_impl.h"
+#include "../sketch_impl.h"
+
+#endif
+
+#include "../sketch.h"
+
+namespace {
+#ifdef ENABLE_FIELD_INT_121
+// 121 bit field
+typedef WideField<121, 0x40001, WideClMul> Field121;
+#endif
+
+#ifdef ENABLE_FIELD_INT_122
+// 122 bit field
+typedef WideField<122, 0x47, WideClMul> Field122;
+#endif
+
+#ifdef ENABLE_FIELD_INT_123
+// 123 bit field
+typedef WideField<123, 0x5, WideClMul> Field123;
+#endif
+
+#ifdef ENABLE_FIELD_INT_124
+// 124 bit field
+typedef WideField<124, 0x80001, WideClMul> Field124;
+#endif
+
+#ifdef ENABLE_FIELD_INT_125
+// 125 bit field
+typedef WideField<125, 0xe1, WideClMul> Field125;
+#endif
+
+#ifdef ENABLE_FIELD_INT_126
+// 126 bit field
+typedef WideField<126, 0x200001, WideClMul> Field126;
+#endif
+
+#ifdef ENABLE_FIELD_INT_127
+// 127 bit field
+typedef WideField<127, 0x3, WideClMul> Field127;
+#endif
+
+#ifdef ENABLE_FIELD_INT_128
+// 128 bit field
+typedef WideField<128, 0x87, WideClMul> Field128;
+#endif
+}
+
+Sketch* ConstructClMul16Bytes(int bits, int implementation)
+{
+    switch (bits) {
+#ifdef ENABLE_FIELD_INT_121
+    case 121: return new SketchImpl<Field121>(implementation, 121);
+#endif
+#ifdef ENABLE_FIELD_INT_122
+    case 122: return new SketchImpl<Field122>(implementation, 122);
+#endif
+#ifdef ENABLE_FIELD_INT_123
+    case 123: return new SketchImpl<Field123>(implementation, 123);
+#endif
+#ifdef ENABLE_FIELD_INT_124
+    case 124: return new SketchImpl<Field124>(implementation, 124);
+#endif
+#ifdef ENABLE_FIELD_INT_125
+    case 125: return new SketchImpl<Field125>(implementation, 125);
+#endif
+#ifdef ENABLE_FIELD_INT_126
+    case 126: return new SketchImpl<Field126>(implementation, 126);
+#endif
+#ifdef ENABLE_FIELD_INT_127
+    case 127: return new SketchImpl<Field127>(implementation, 127);
+#endif
+#ifdef ENABLE_FIELD_INT_128
+    case 128: return new SketchImpl<Field128>(implementation, 128);
+#endif
+    default: return nullptr;
+    }
+}
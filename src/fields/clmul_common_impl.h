@@ -101,8 +101,118 @@ template<typename I, int BITS, int POS> NO_SANITIZE_MEMORY I MulTrinomial(I a, I
     }
 }
 
-/** Implementation of fields that use the SSE clmul intrinsic for multiplication. */
-template<typename I, int B, I MOD, I (*MUL)(I, I), typename F, const F* SQR, const F* SQR2, const F* SQR4, const F* SQR8, const F* SQR16, const F* QRT, typename T, const T* LOAD, const T* SAVE> struct GenField
+/** Helpers for processing several small field elements per SSE register, in 32-bit lanes if L32, in 64-bit lanes otherwise. */
+template<bool L32> struct ClMulLanes
+{
+    static constexpr size_t COUNT = L32 ? 4 : 2;
+
+    template<typename I> static inline __m128i Load(const I* src)
+    {
+        if (L32) return _mm_set_epi32(uint32_t(src[3]), uint32_t(src[2]), uint32_t(src[1]), uint32_t(src[0]));
+        return _mm_set_epi64x(uint64_t(src[1]), uint64_t(src[0]));
+    }
+
+    template<typename I, bool ADD> static inline void Store(I* dst, __m128i val, I mask)
+    {
+        alignas(16) uint64_t lanes[2];
+        _mm_store_si128((__m128i*)lanes, val);
+        for (size_t i = 0; i < COUNT; ++i) {
+            I elem = I(L32 ? lanes[i / 2] >> (32 * (i & 1)) : lanes[i]) & mask;
+            dst[i] = ADD ? dst[i] ^ elem : elem;
+        }
+    }
+
+    static inline __m128i Srli(__m128i val, int bits) { return L32 ? _mm_srli_epi32(val, bits) : _mm_srli_epi64(val, bits); }
+    static inline __m128i Slli(__m128i val, int bits) { return L32 ? _mm_slli_epi32(val, bits) : _mm_slli_epi64(val, bits); }
+
+    /** Multiply every lane by b (as long as no lane product overflows its lane). Lanes within one 64-bit half
+     *  are multiplied by the same PCLMUL. */
+    static NO_SANITIZE_MEMORY inline __m128i Mul(__m128i val, __m128i b)
+    {
+        return _mm_unpacklo_epi64(_mm_clmulepi64_si128(val, b, 0x00), _mm_clmulepi64_si128(val, b, 0x01));
+    }
+};
+
+/** Compute dst[i] = a*src[i] (or dst[i] ^= a*src[i] if ADD) for i in [0,n), with the same result as MulWithClMulReduce.
+ *
+ * Fields of up to 32 bits are processed several elements at a time, with all reductions done on full
+ * registers. Up to 16 bits, elements are packed 32 bits apart so that a single PCLMUL multiplies two of them.
+ */
+template<typename I, int BITS, I MOD, bool ADD> NO_SANITIZE_MEMORY void MulVecWithClMulReduce(I a, const I* src, I* dst, size_t n)
+{
+    size_t i = 0;
+    if (BITS <= 32) {
+        typedef ClMulLanes<BITS <= 16> V;
+        static constexpr I MASK = Mask<BITS, I>();
+        const __m128i MOD128 = _mm_cvtsi64_si128(MOD);
+        const __m128i A = _mm_cvtsi64_si128((uint64_t)a);
+        for (; i + V::COUNT <= n; i += V::COUNT) {
+            __m128i product = V::Mul(V::Load(src + i), A);
+            __m128i red1 = V::Mul(V::Srli(product, BITS), MOD128);
+            __m128i red2 = V::Mul(V::Srli(red1, BITS), MOD128);
+            V::template Store<I, ADD>(dst + i, _mm_xor_si128(_mm_xor_si128(product, red1), red2), MASK);
+        }
+    }
+    for (; i < n; ++i) {
+        I prod = MulWithClMulReduce<I, BITS, MOD>(a, src[i]);
+        dst[i] = ADD ? dst[i] ^ prod : prod;
+    }
+}
+
+/** Like MulVecWithClMulReduce, but with the same result as MulTrinomial. */
+template<typename I, int BITS, int POS, bool ADD> NO_SANITIZE_MEMORY void MulVecTrinomial(I a, const I* src, I* dst, size_t n)
+{
+    size_t i = 0;
+    if (BITS <= 32) {
+        typedef ClMulLanes<BITS <= 16> V;
+        static constexpr I MASK = Mask<BITS, I>();
+        const __m128i A = _mm_cvtsi64_si128((uint64_t)a);
+        for (; i + V::COUNT <= n; i += V::COUNT) {
+            __m128i product = V::Mul(V::Load(src + i), A);
+            __m128i high1 = V::Srli(product, BITS);
+            __m128i red1 = _mm_xor_si128(high1, V::Slli(high1, POS));
+            if (POS != 1) {
+                __m128i high2 = V::Srli(red1, BITS);
+                red1 = _mm_xor_si128(red1, _mm_xor_si128(high2, V::Slli(high2, POS)));
+            }
+            V::template Store<I, ADD>(dst + i, _mm_xor_si128(product, red1), MASK);
+        }
+    }
+    for (; i < n; ++i) {
+        I prod = MulTrinomial<I, BITS, POS>(a, src[i]);
+        dst[i] = ADD ? dst[i] ^ prod : prod;
+    }
+}
+
+/** Implementation of fields that use the SSE clmul intrinsic for multiplication.
+ *
+ * Elements are represented in a polynomial basis, possibly modulo a different irreducible polynomial
+ * than the serialized form (LOAD and SAVE convert between the two). A normal basis would make
+ * squaring a rotation, but decoding performs far more multiplications than squarings (squarings are
+ * roughly 12% of field operations for 16 elements, and under 1% for 1000), and normal-basis
+ * multiplication cannot use clmul directly.
+ */
+/** Carry-less 64x64 bit products for fields over 64 bits (see wide_common_impl.h), using clmul. */
+struct WideClMul
+{
+    /** Nothing needs precomputing for clmul. */
+    struct Multiples
+    {
+        uint64_t val;
+        explicit Multiples(uint64_t a) : val(a) {}
+    };
+
+    static NO_SANITIZE_MEMORY inline void Mul(const Multiples& a, uint64_t b, uint64_t& lo, uint64_t& hi)
+    {
+        __m128i product = _mm_clmulepi64_si128(_mm_cvtsi64_si128(a.val), _mm_cvtsi64_si128(b), 0x00);
+        lo = _mm_cvtsi128_si64(product);
+        hi = _mm_cvtsi128_si64(_mm_unpackhi_epi64(product, product));
+    }
+
+    static inline void Sqr(uint64_t a, uint64_t& lo, uint64_t& hi) { Mul(Multiples(a), a, lo, hi); }
+};
+
+template<typename I, int B, I MOD, I (*MUL)(I, I), void (*MULVEC)(I, const I*, I*, size_t), void (*AXPYVEC)(I, const I*, I*, size_t), typename F, const F* SQR, const F* SQR2, const F* SQR4, const F* SQR8, const F* SQR16, const F* QRT, typename T, const T* LOAD, const T* SAVE> struct GenField
 {
     typedef BitsInt<I, B> O;
     typedef LFSR<O, MOD> L;
@@ -122,6 +232,13 @@ public:
 
     inline Elem Mul(Elem a, Elem b) const { return MUL(a, b); }
 
+    /** Compute dst[i] = a*src[i] for i in [0,n). src and dst may be equal, or dst may start at least 16 elements
+     *  after src (elements are processed in increasing order). */
+    inline void MulVec(Elem a, const Elem* src, Elem* dst, size_t n) const { MULVEC(a, src, dst, n); }
+
+    /** Compute dst[i] ^= a*src[i] for i in [0,n). */
+    inline void AxpyVec(Elem a, const Elem* src, Elem* dst, size_t n) const { AXPYVEC(a, src, dst, n); }
+
     class Multiplier
     {
         Elem m_val;
@@ -130,8 +247,13 @@ public:
         constexpr Elem operator()(Elem a) const { return MUL(m_val, a); }
     };
 
-    /** Compute the square of a. */
-    inline constexpr Elem Sqr(Elem val) const { return SQR->template Map<O>(val); }
+    /** Compute the square of a.
+     *
+     * For fields over 48 bits the squaring table has 9 or more chunks, and a clmul with reduction is
+     * faster for independent squarings. It also keeps the table out of the cache. The chained squarings
+     * in Inv still use the tables.
+     */
+    inline Elem Sqr(Elem val) const { return B > 48 ? MUL(val, val) : SQR->template Map<O>(val); }
 
     /** Compute x such that x^2 + x = a (undefined result if no solution exists). */
     inline constexpr Elem Qrt(Elem val) const { return QRT->template Map<O>(val); }
@@ -139,6 +261,22 @@ public:
     /** Compute the inverse of x1. */
     inline Elem Inv(Elem val) const { return InvLadder<I, O, B, MUL, Sqr1, Sqr2, Sqr4, Sqr8, Sqr16>(val); }
 
+    /** Replace each of vals[0..n) (which must be nonzero) by its inverse, using one inversion and 3(n-1)
+     *  multiplications (Montgomery's trick). tmp must have room for n elements. */
+    void InvVec(Elem* vals, Elem* tmp, size_t n) const
+    {
+        if (n == 0) return;
+        tmp[0] = vals[0];
+        for (size_t i = 1; i < n; ++i) tmp[i] = Mul(tmp[i - 1], vals[i]);
+        Elem inv = Inv(tmp[n - 1]);
+        for (size_t i = n - 1; i > 0; --i) {
+            Elem val = vals[i];
+            vals[i] = Mul(inv, tmp[i - 1]);
+            inv = Mul(inv, val);
+        }
+        vals[0] = inv;
+    }
+
     /** Generate a random field element. */
     Elem FromSeed(uint64_t seed) const {
         uint64_t k0 = 0x434c4d554c466c64ull; // "CLMULFld"
@@ -160,10 +298,10 @@ public:
 };
 
 template<typename I, int B, I MOD, typename F, const F* SQR, const F* SQR2, const F* SQR4, const F* SQR8, const F* SQR16, const F* QRT, typename T, const T* LOAD, const T* SAVE>
-using Field = GenField<I, B, MOD, MulWithClMulReduce<I, B, MOD>, F, SQR, SQR2, SQR4, SQR8, SQR16, QRT, T, LOAD, SAVE>;
+using Field = GenField<I, B, MOD, MulWithClMulReduce<I, B, MOD>, MulVecWithClMulReduce<I, B, MOD, false>, MulVecWithClMulReduce<I, B, MOD, true>, F, SQR, SQR2, SQR4, SQR8, SQR16, QRT, T, LOAD, SAVE>;
 
 template<typename I, int B, int POS, typename F, const F* SQR, const F* SQR2, const F* SQR4, const F* SQR8, const F* SQR16, const F* QRT, typename T, const T* LOAD, const T* SAVE>
-using FieldTri = GenField<I, B, I(1) + (I(1) << POS), MulTrinomial<I, B, POS>, F, SQR, SQR2, SQR4, SQR8, SQR16, QRT, T, LOAD, SAVE>;
+using FieldTri = GenField<I, B, I(1) + (I(1) << POS), MulTrinomial<I, B, POS>, MulVecTrinomial<I, B, POS, false>, MulVecTrinomial<I, B, POS, true>, F, SQR, SQR2, SQR4, SQR8, SQR16, QRT, T, LOAD, SAVE>;
 
 }
 
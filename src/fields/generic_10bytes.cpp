@@ -0,0 +1,89 @@
+/**********************************************************************
+ * Copyright (c) 2018 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#include "../fielddefines.h"
+
+#if defined(ENABLE_FIELD_BYTES_INT_10)
+
+#include "wide_common_impl.h"
+#include "../sketch_impl.h"
+
+#endif
+
+#include "../sketch.h"
+
+namespace {
+#ifdef ENABLE_FIELD_INT_73
+// 73 bit field
+typedef WideField<73, 0x2000001, WideGenericMul> Field73;
+#endif
+
+#ifdef ENABLE_FIELD_INT_74
+// 74 bit field
+typedef WideField<74, 0x800000001, WideGenericMul> Field74;
+#endif
+
+#ifdef ENABLE_FIELD_INT_75
+// 75 bit field
+typedef WideField<75, 0x4b, WideGenericMul> Field75;
+#endif
+
+#ifdef ENABLE_FIELD_INT_76
+// 76 bit field
+typedef WideField<76, 0x200001, WideGenericMul> Field76;
+#endif
+
+#ifdef ENABLE_FIELD_INT_77
+// 77 bit field
+typedef WideField<77, 0x65, WideGenericMul> Field77;
+#endif
+
+#ifdef ENABLE_FIELD_INT_78
+// 78 bit field
+typedef WideField<78, 0x69, WideGenericMul> Field78;
+#endif
+
+#ifdef ENABLE_FIELD_INT_79
+// 79 bit field
+typedef WideField<79, 0x201, WideGenericMul> Field79;
+#endif
+
+#ifdef ENABLE_FIELD_INT_80
+// 80 bit field
+typedef WideField<80, 0x215, WideGenericMul> Field80;
+#endif
+}
+
+Sketch* ConstructGeneric10Bytes(int bits, int implementation)
+{
+    switch (bits) {
+#ifdef ENABLE_FIELD_INT_73
+    case 73: return new SketchImpl<Field73>(implementation, 73);
+#endif
+#ifdef ENABLE_FIELD_INT_74
+    case 74: return new SketchImpl<Field74>(implementation, 74);
+#endif
+#ifdef ENABLE_FIELD_INT_75
+    case 75: return new SketchImpl<Field75>(implementation, 75);
+#endif
+#ifdef ENABLE_FIELD_INT_76
+    case 76: return new SketchImpl<Field76>(implementation, 76);
+#endif
+#ifdef ENABLE_FIELD_INT_77
+    case 77: return new SketchImpl<Field77>(implementation, 77);
+#endif
+#ifdef ENABLE_FIELD_INT_78
+    case 78: return new SketchImpl<Field78>(implementation, 78);
+#endif
+#ifdef ENABLE_FIELD_INT_79
+    case 79: return new SketchImpl<Field79>(implementation, 79);
+#endif
+#ifdef ENABLE_FIELD_INT_80
+    case 80: return new SketchImpl<Field80>(implementation, 80);
+#endif
+    default: return nullptr;
+    }
+}
@@ -0,0 +1,89 @@
+/**********************************************************************
+ * Copyright (c) 2018 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#include "../fielddefines.h"
+
+#if defined(ENABLE_FIELD_BYTES_INT_11)
+
+#include "wide_common_impl.h"
+#include "../sketch_impl.h"
+
+#endif
+
+#include "../sketch.h"
+
+namespace {
+#ifdef ENABLE_FIELD_INT_81
+// 81 bit field
+typedef WideField<81, 0x11, WideGenericMul> Field81;
+#endif
+
+#ifdef ENABLE_FIELD_INT_82
+// 82 bit field
+typedef WideField<82, 0x10b, WideGenericMul> Field82;
+#endif
+
+#ifdef ENABLE_FIELD_INT_83
+// 83 bit field
+typedef WideField<83, 0x95, WideGenericMul> Field83;
+#endif
+
+#ifdef ENABLE_FIELD_INT_84
+// 84 bit field
+typedef WideField<84, 0x21, WideGenericMul> Field84;
+#endif
+
+#ifdef ENABLE_FIELD_INT_85
+// 85 bit field
+typedef WideField<85, 0x107, WideGenericMul> Field85;
+#endif
+
+#ifdef ENABLE_FIELD_INT_86
+// 86 bit field
+typedef WideField<86, 0x200001, WideGenericMul> Field86;
+#endif
+
+#ifdef ENABLE_FIELD_INT_87
+// 87 bit field
+typedef WideField<87, 0x2001, WideGenericMul> Field87;
+#endif
+
+#ifdef ENABLE_FIELD_INT_88
+// 88 bit field
+typedef WideField<88, 0xc5, WideGenericMul> Field88;
+#endif
+}
+
+Sketch* ConstructGeneric11Bytes(int bits, int implementation)
+{
+    switch (bits) {
+#ifdef ENABLE_FIELD_INT_81
+    case 81: return new SketchImpl<Field81>(implementation, 81);
+#endif
+#ifdef ENABLE_FIELD_INT_82
+    case 82: return new SketchImpl<Field82>(implementation, 82);
+#endif
+#ifdef ENABLE_FIELD_INT_83
+    case 83: return new SketchImpl<Field83>(implementation, 83);
+#endif
+#ifdef ENABLE_FIELD_INT_84
+    case 84: return new SketchImpl<Field84>(implementation, 84);
+#endif
+#ifdef ENABLE_FIELD_INT_85
+    case 85: return new SketchImpl<Field85>(implementation, 85);
+#endif
+#ifdef ENABLE_FIELD_INT_86
+    case 86: return new SketchImpl<Field86>(implementation, 86);
+#endif
+#ifdef ENABLE_FIELD_INT_87
+    case 87: return new SketchImpl<Field87>(implementation, 87);
+#endif
+#ifdef ENABLE_FIELD_INT_88
+    case 88: return new SketchImpl<Field88>(implementation, 88);
+#endif
+    default: return nullptr;
+    }
+}
@@ -0,0 +1,89 @@
+/**********************************************************************
+ * Copyright (c) 2018 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#include "../fielddefines.h"
+
+#if defined(ENABLE_FIELD_BYTES_INT_13)
+
+#include "wide_common_impl.h"
+#include "../sketch_impl.h"
+
+#endif
+
+#include "../sketch.h"
+
+namespace {
+#ifdef ENABLE_FIELD_INT_97
+// 97 bit field
+typedef WideField<97, 0x41, WideGenericMul> Field97;
+#endif
+
+#ifdef ENABLE_FIELD_INT_98
+// 98 bit field
+typedef WideField<98, 0x801, WideGenericMul> Field98;
+#endif
+
+#ifdef ENABLE_FIELD_INT_99
+// 99 bit field
+typedef WideField<99, 0x4b, WideGenericMul> Field99;
+#endif
+
+#ifdef ENABLE_FIELD_INT_100
+// 100 bit field
+typedef WideField<100, 0x8001, WideGenericMul> Field100;
+#endif
+
+#ifdef ENABLE_FIELD_INT_101
+// 101 bit field
+typedef WideField<101, 0xc3, WideGenericMul> Field101;
+#endif
+
+#ifdef ENABLE_FIELD_INT_102
+// 102 bit field
+typedef WideField<102, 0x20000001, WideGenericMul> Field102;
+#endif
+
+#ifdef ENABLE_FIELD_INT_103
+// 103 bit field
+typedef WideField<103, 0x201, WideGenericMul> Field103;
+#endif
+
+#ifdef ENABLE_FIELD_INT_104
+// 104 bit field
+typedef WideField<104, 0x1b, WideGenericMul> Field104;
+#endif
+}
+
+Sketch* ConstructGeneric13Bytes(int bits, int implementation)
+{
+    switch (bits) {
+#ifdef ENABLE_FIELD_INT_97
+    case 97: return new SketchImpl<Field97>(implementation, 97);
+#endif
+#ifdef ENABLE_FIELD_INT_98
+    case 98: return new SketchImpl<Field98>(implementation, 98);
+#endif
+#ifdef ENABLE_FIELD_INT_99
+    case 99: return new SketchImpl<Field99>(implementation, 99);
+#endif
+#ifdef ENABLE_FIELD_INT_100
+    case 100: return new SketchImpl<Field100>(implementation, 100);
+#endif
+#ifdef ENABLE_FIELD_INT_101
+    case 101: return new SketchImpl<Field101>(implementation, 101);
+#endif
+#ifdef ENABLE_FIELD_INT_102
+    case 102: return new SketchImpl<Field102>(implementation, 102);
+#endif
+#ifdef ENABLE_FIELD_INT_103
+    case 103: return new SketchImpl<Field103>(implementation, 103);
+#endif
+#ifdef ENABLE_FIELD_INT_104
+    case 104: return new SketchImpl<Field104>(implementation, 104);
+#endif
+    default: return nullptr;
+    }
+}
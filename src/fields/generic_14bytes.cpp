@@ -0,0 +1,89 @@
+/**********************************************************************
+ * Copyright (c) 2018 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#include "../fielddefines.h"
+
+#if defined(ENABLE_FIELD_BYTES_INT_14)
+
+#include "wide_common_impl.h"
+#include "../sketch_impl.h"
+
+#endif
+
+#include "../sketch.h"
+
+namespace {
+#ifdef ENABLE_FIELD_INT_105
+// 105 bit field
+typedef WideField<105, 0x11, WideGenericMul> Field105;
+#endif
+
+#ifdef ENABLE_FIELD_INT_106
+// 106 bit field
+typedef WideField<106, 0x8001, WideGenericMul> Field106;
+#endif
+
+#ifdef ENABLE_FIELD_INT_107
+// 107 bit field
+typedef WideField<107, 0x291, WideGenericMul> Field107;
+#endif
+
+#ifdef ENABLE_FIELD_INT_108
+// 108 bit field
+typedef WideField<108, 0x20001, WideGenericMul> Field108;
+#endif
+
+#ifdef ENABLE_FIELD_INT_109
+// 109 bit field
+typedef WideField<109, 0x35, WideGenericMul> Field109;
+#endif
+
+#ifdef ENABLE_FIELD_INT_110
+// 110 bit field
+typedef WideField<110, 0x200000001, WideGenericMul> Field110;
+#endif
+
+#ifdef ENABLE_FIELD_INT_111
+// 111 bit field
+typedef WideField<111, 0x401, WideGenericMul> Field111;
+#endif
+
+#ifdef ENABLE_FIELD_INT_112
+// 112 bit field
+typedef WideField<112, 0x39, WideGenericMul> Field112;
+#endif
+}
+
+Sketch* ConstructGeneric14Bytes(int bits, int implementation)
+{
+    switch (bits) {
+#ifdef ENABLE_FIELD_INT_105
+    case 105: return new SketchImpl<Field105>(implementation, 105);
+#endif
+#ifdef ENABLE_FIELD_INT_106
+    case 106: return new SketchImpl<Field106>(implementation, 106);
+#endif
+#ifdef ENABLE_FIELD_INT_107
+    case 107: return new SketchImpl<Field107>(implementation, 107);
+#endif
+#ifdef ENABLE_FIELD_INT_108
+    case 108: return new SketchImpl<Field108>(implementation, 108);
+#endif
+#ifdef ENABLE_FIELD_INT_109
+    case 109: return new SketchImpl<Field109>(implementation, 109);
+#endif
+#ifdef ENABLE_FIELD_INT_110
+    case 110: return new SketchImpl<Field110>(implementation, 110);
+#endif
+#ifdef ENABLE_FIELD_INT_111
+    case 111: return new SketchImpl<Field111>(implementation, 111);
+#endif
+#ifdef ENABLE_FIELD_INT_112
+    case 112: return new SketchImpl<Field112>(implementation, 112);
+#endif
+    default: return nullptr;
+    }
+}
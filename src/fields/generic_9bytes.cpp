@@ -0,0 +1,89 @@
+/**********************************************************************
+ * Copyright (c) 2018 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#include "../fielddefines.h"
+
+#if defined(ENABLE_FIELD_BYTES_INT_9)
+
+#include "wide_common_impl.h"
+#include "../sketch_impl.h"
+
+#endif
+
+#include "../sketch.h"
+
+namespace {
+#ifdef ENABLE_FIELD_INT_65
+// 65 bit field
+typedef WideField<65, 0x40001, WideGenericMul> Field65;
+#endif
+
+#ifdef ENABLE_FIELD_INT_66
+// 66 bit field
+typedef WideField<66, 0x9, WideGenericMul> Field66;
+#endif
+
+#ifdef ENABLE_FIELD_INT_67
+// 67 bit field
+typedef WideField<67, 0x27, WideGenericMul> Field67;
+#endif
+
+#ifdef ENABLE_FIELD_INT_68
+// 68 bit field
+typedef WideField<68, 0x201, WideGenericMul> Field68;
+#endif
+
+#ifdef ENABLE_FIELD_INT_69
+// 69 bit field
+typedef WideField<69, 0x65, WideGenericMul> Field69;
+#endif
+
+#ifdef ENABLE_FIELD_INT_70
+// 70 bit field
+typedef WideField<70, 0x2b, WideGenericMul> Field70;
+#endif
+
+#ifdef ENABLE_FIELD_INT_71
+// 71 bit field
+typedef WideField<71, 0x41, WideGenericMul> Field71;
+#endif
+
+#ifdef ENABLE_FIELD_INT_72
+// 72 bit field
+typedef WideField<72, 0x609, WideGenericMul> Field72;
+#endif
+}
+
+Sketch* ConstructGeneric9Bytes(int bits, int implementation)
+{
+    switch (bits) {
+#ifdef ENABLE_FIELD_INT_65
+    case 65: return new SketchImpl<Field65>(implementation, 65);
+#endif
+#ifdef ENABLE_FIELD_INT_66
+    case 66: return new SketchImpl<Field66>(implementation, 66);
+#endif
+#ifdef ENABLE_FIELD_INT_67
+    case 67: return new SketchImpl<Field67>(implementation, 67);
+#endif
+#ifdef ENABLE_FIELD_INT_68
+    case 68: return new SketchImpl<Field68>(implementation, 68);
+#endif
+#ifdef ENABLE_FIELD_INT_69
+    case 69: return new SketchImpl<Field69>(implementation, 69);
+#endif
+#ifdef ENABLE_FIELD_INT_70
+    case 70: return new SketchImpl<Field70>(implementation, 70);
+#endif
+#ifdef ENABLE_FIELD_INT_71
+    case 71: return new SketchImpl<Field71>(implementation, 71);
+#endif
+#ifdef ENABLE_FIELD_INT_72
+    case 72: return new SketchImpl<Field72>(implementation, 72);
+#endif
+    default: return nullptr;
+    }
+}
@@ -12,14 +12,110 @@
 #include "../int_utils.h"
 #include "../lintrans.h"
 
+#ifdef HAVE_SSSE3
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#  else
+#    include <cpuid.h>
+#  endif
+
+/** Compute dst[i] = m*src[i] (or dst[i] ^= m*src[i] if add) for i in [0,n), using split-nibble tables for m (see generic_ssse3.cpp). */
+void NibbleMulVecSSSE3(const unsigned char* tables, int elem_size, int bytes, const void* src, void* dst, size_t n, bool add);
+#endif
+
 namespace {
 
+#ifdef HAVE_SSSE3
+inline bool EnableSSSE3()
+{
+#ifdef _MSC_VER
+    int regs[4];
+    __cpuid(regs, 1);
+    return (regs[2] & 0x200);
+#else
+    uint32_t eax, ebx, ecx, edx;
+    return (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & 0x200));
+#endif
+}
+
+/** Whether NibbleMulVecSSSE3 can be used (detected once). */
+inline bool HaveSSSE3()
+{
+    static const bool ret = EnableSSSE3();
+    return ret;
+}
+#endif
+
+/** Whether to multiply elements of fields over 32 bits using two uint32_t limbs. On 32-bit hosts, every
+ *  uint64_t operation in the bit-serial loop of GFMul is emulated by several 32-bit ones, including the
+ *  negations used to build masks. Define FORCE_LIMB32_MUL to use the limb code elsewhere, for testing. */
+#ifdef FORCE_LIMB32_MUL
+constexpr bool LIMB32_MUL = true;
+#else
+constexpr bool LIMB32_MUL = sizeof(void*) == 4;
+#endif
+
+/** Compute the product of a and b in GF(2^B) with modulus x^B + MOD (32 < B <= 64), on 32-bit limbs. */
+template<int B, uint32_t MOD> inline uint64_t GFMulLimb32(uint64_t a, uint64_t b)
+{
+    static_assert(B > 32 && B <= 64, "GFMulLimb32 needs 32 < B <= 64");
+    const uint32_t hi_mask = Mask<B - 32, uint32_t>();
+    uint32_t alo = uint32_t(a), ahi = uint32_t(a >> 32), blo = uint32_t(b), bhi = uint32_t(b >> 32);
+    uint32_t rlo = 0, rhi = 0;
+    for (int i = 0; i < B; ++i) {
+        uint32_t bit = -(blo & 1);
+        blo = (blo >> 1) | (bhi << 31);
+        bhi >>= 1;
+        rlo ^= alo & bit;
+        rhi ^= ahi & bit;
+        // Multiply a by x.
+        uint32_t top = -((ahi >> (B - 33)) & 1);
+        ahi = ((ahi << 1) | (alo >> 31)) & hi_mask;
+        alo = (alo << 1) ^ (MOD & top);
+    }
+    return rlo | (uint64_t(rhi) << 32);
+}
+
+template<bool LIMB32> struct GenericMul
+{
+    template<typename I, int B, uint32_t MOD, typename L, typename O> static inline I Run(I a, I b) { return GFMul<I, B, L, O>(a, b); }
+};
+
+template<> struct GenericMul<true>
+{
+    template<typename I, int B, uint32_t MOD, typename L, typename O> static inline I Run(I a, I b) { return GFMulLimb32<B, MOD>(a, b); }
+};
+
 /** Generic implementation for fields whose elements can be represented by an integer type. */
 template<typename I, int B, uint32_t MOD, typename F, typename T, const F* SQR, const F* QRT> class Field
 {
     typedef BitsInt<I, B> O;
     typedef LFSR<O, MOD> L;
 
+#ifdef HAVE_SSSE3
+    static constexpr int BYTES = (B + 7) / 8;
+    static constexpr size_t NIBBLE_TABLES_SIZE = 2 * BYTES * BYTES * 16;
+    //! Below this many elements, building the nibble tables costs more than it saves. The number of
+    //! lookups per element grows quadratically with BYTES, so beyond 3 bytes the tables never win.
+    static constexpr size_t NIBBLE_MIN_SIZE = BYTES <= 3 ? 128 * BYTES : (size_t)-1;
+
+    /** Build the tables for NibbleMulVecSSSE3: byte j of a times every value of nibble k is at position (k*BYTES+j)*16. */
+    void BuildNibbleTables(I a, unsigned char* tables) const
+    {
+        I vals[16];
+        vals[0] = 0;
+        for (int k = 0; k < 2 * BYTES; ++k) {
+            for (int bit = 0; bit < 4; ++bit) {
+                for (int v = 0; v < (1 << bit); ++v) vals[(1 << bit) + v] = vals[v] ^ a;
+                a = L::Call(a);
+            }
+            for (int j = 0; j < BYTES; ++j) {
+                for (int v = 0; v < 16; ++v) tables[(k * BYTES + j) * 16 + v] = (unsigned char)(vals[v] >> (8 * j));
+            }
+        }
+    }
+#endif
+
 public:
     typedef I Elem;
     constexpr int Bits() const { return B; }
@@ -34,7 +130,38 @@ public:
         constexpr inline Elem operator()(Elem a) const { return table.template Map<O>(a); }
     };
 
-    Elem Mul(Elem a, Elem b) const { return GFMul<I, B, L, O>(a, b); }
+    Elem Mul(Elem a, Elem b) const { return GenericMul<LIMB32_MUL && (B > 32)>::template Run<I, B, MOD, L, O>(a, b); }
+
+    /** Compute dst[i] = a*src[i] for i in [0,n). src and dst may be equal, or dst may start at least 16 elements
+     *  after src (elements are processed in increasing order). */
+    void MulVec(Elem a, const Elem* src, Elem* dst, size_t n) const
+    {
+#ifdef HAVE_SSSE3
+        if (n >= NIBBLE_MIN_SIZE && HaveSSSE3()) {
+            unsigned char tables[NIBBLE_TABLES_SIZE];
+            BuildNibbleTables(a, tables);
+            NibbleMulVecSSSE3(tables, sizeof(I), BYTES, src, dst, n, false);
+            return;
+        }
+#endif
+        Multiplier mul(*this, a);
+        for (size_t i = 0; i < n; ++i) dst[i] = mul(src[i]);
+    }
+
+    /** Compute dst[i] ^= a*src[i] for i in [0,n). */
+    void AxpyVec(Elem a, const Elem* src, Elem* dst, size_t n) const
+    {
+#ifdef HAVE_SSSE3
+        if (n >= NIBBLE_MIN_SIZE && HaveSSSE3()) {
+            unsigned char tables[NIBBLE_TABLES_SIZE];
+            BuildNibbleTables(a, tables);
+            NibbleMulVecSSSE3(tables, sizeof(I), BYTES, src, dst, n, true);
+            return;
+        }
+#endif
+        Multiplier mul(*this, a);
+        for (size_t i = 0; i < n; ++i) dst[i] ^= mul(src[i]);
+    }
 
     /** Compute the square of a. */
     inline constexpr Elem Sqr(Elem a) const { return SQR->template Map<O>(a); }
@@ -45,6 +172,22 @@ public:
     /** Compute the inverse of x1. */
     Elem Inv(Elem a) const { return InvExtGCD<I, O, B, MOD>(a); }
 
+    /** Replace each of vals[0..n) (which must be nonzero) by its inverse, using one inversion and 3(n-1)
+     *  multiplications (Montgomery's trick). tmp must have room for n elements. */
+    void InvVec(Elem* vals, Elem* tmp, size_t n) const
+    {
+        if (n == 0) return;
+        tmp[0] = vals[0];
+        for (size_t i = 1; i < n; ++i) tmp[i] = Mul(tmp[i - 1], vals[i]);
+        Elem inv = Inv(tmp[n - 1]);
+        for (size_t i = n - 1; i > 0; --i) {
+            Elem val = vals[i];
+            vals[i] = Mul(inv, tmp[i - 1]);
+            inv = Mul(inv, val);
+        }
+        vals[0] = inv;
+    }
+
     /** Generate a random field element. */
     Elem FromSeed(uint64_t seed) const {
         uint64_t k0 = 0x496e744669656c64ull; // "IntField"
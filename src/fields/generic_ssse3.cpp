@@ -0,0 +1,158 @@
+/**********************************************************************
+ * Copyright (c) 2026 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+/* Split-nibble table multiplication for the generic fields, using SSSE3's PSHUFB.
+ *
+ * Multiplication by a constant is linear, so the product with an element is the XOR of the
+ * products with each of its 4-bit nibbles. For every nibble position and output byte, a 16-entry
+ * table of those is built (by the caller), which PSHUFB can look up for 16 elements at once. To do
+ * so, blocks of 16 elements are first transposed into byte planes (one register per byte position),
+ * and transposed back afterwards.
+ *
+ * This file is compiled with -mssse3, and must only be called into after checking CPU support.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <tmmintrin.h>
+
+namespace {
+
+/** Transpose 16 elements of SIZE bytes (in SIZE registers) into SIZE byte planes. */
+template<int SIZE> inline void ToPlanes(const __m128i* in, __m128i* planes)
+{
+    if (SIZE == 1) {
+        planes[0] = in[0];
+    } else if (SIZE == 2) {
+        const __m128i shuf = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+        __m128i a = _mm_shuffle_epi8(in[0], shuf), b = _mm_shuffle_epi8(in[1], shuf);
+        planes[0] = _mm_unpacklo_epi64(a, b);
+        planes[1] = _mm_unpackhi_epi64(a, b);
+    } else if (SIZE == 4) {
+        const __m128i shuf = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+        __m128i a[4];
+        for (int i = 0; i < 4; ++i) a[i] = _mm_shuffle_epi8(in[i], shuf);
+        __m128i t0 = _mm_unpacklo_epi32(a[0], a[1]), t1 = _mm_unpacklo_epi32(a[2], a[3]);
+        __m128i t2 = _mm_unpackhi_epi32(a[0], a[1]), t3 = _mm_unpackhi_epi32(a[2], a[3]);
+        planes[0] = _mm_unpacklo_epi64(t0, t1);
+        planes[1] = _mm_unpackhi_epi64(t0, t1);
+        planes[2] = _mm_unpacklo_epi64(t2, t3);
+        planes[3] = _mm_unpackhi_epi64(t2, t3);
+    } else {
+        const __m128i shuf = _mm_setr_epi8(0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15);
+        __m128i a[8], b[8];
+        for (int i = 0; i < 8; ++i) a[i] = _mm_shuffle_epi8(in[i], shuf);
+        for (int i = 0; i < 4; ++i) {
+            b[2 * i] = _mm_unpacklo_epi16(a[2 * i], a[2 * i + 1]);
+            b[2 * i + 1] = _mm_unpackhi_epi16(a[2 * i], a[2 * i + 1]);
+        }
+        for (int i = 0; i < 2; ++i) {
+            a[4 * i] = _mm_unpacklo_epi32(b[4 * i], b[4 * i + 2]);
+            a[4 * i + 1] = _mm_unpackhi_epi32(b[4 * i], b[4 * i + 2]);
+            a[4 * i + 2] = _mm_unpacklo_epi32(b[4 * i + 1], b[4 * i + 3]);
+            a[4 * i + 3] = _mm_unpackhi_epi32(b[4 * i + 1], b[4 * i + 3]);
+        }
+        for (int i = 0; i < 4; ++i) {
+            planes[2 * i] = _mm_unpacklo_epi64(a[i], a[i + 4]);
+            planes[2 * i + 1] = _mm_unpackhi_epi64(a[i], a[i + 4]);
+        }
+    }
+}
+
+/** Inverse of ToPlanes. */
+template<int SIZE> inline void FromPlanes(const __m128i* planes, __m128i* out)
+{
+    if (SIZE == 1) {
+        out[0] = planes[0];
+    } else if (SIZE == 2) {
+        out[0] = _mm_unpacklo_epi8(planes[0], planes[1]);
+        out[1] = _mm_unpackhi_epi8(planes[0], planes[1]);
+    } else if (SIZE == 4) {
+        __m128i a = _mm_unpacklo_epi8(planes[0], planes[1]), b = _mm_unpackhi_epi8(planes[0], planes[1]);
+        __m128i c = _mm_unpacklo_epi8(planes[2], planes[3]), d = _mm_unpackhi_epi8(planes[2], planes[3]);
+        out[0] = _mm_unpacklo_epi16(a, c);
+        out[1] = _mm_unpackhi_epi16(a, c);
+        out[2] = _mm_unpacklo_epi16(b, d);
+        out[3] = _mm_unpackhi_epi16(b, d);
+    } else {
+        __m128i a[8], b[8];
+        for (int i = 0; i < 4; ++i) {
+            a[2 * i] = _mm_unpacklo_epi8(planes[2 * i], planes[2 * i + 1]);
+            a[2 * i + 1] = _mm_unpackhi_epi8(planes[2 * i], planes[2 * i + 1]);
+        }
+        // a[2*i] holds byte pairs (2*i, 2*i+1) of elements 0..7, a[2*i+1] of elements 8..15.
+        for (int h = 0; h < 2; ++h) {
+            for (int i = 0; i < 2; ++i) {
+                b[4 * h + 2 * i] = _mm_unpacklo_epi16(a[4 * i + h], a[4 * i + 2 + h]);
+                b[4 * h + 2 * i + 1] = _mm_unpackhi_epi16(a[4 * i + h], a[4 * i + 2 + h]);
+            }
+        }
+        // b[4*h+2*i+k] holds bytes 4*i..4*i+3 of elements 8*h+4*k..8*h+4*k+3.
+        for (int h = 0; h < 2; ++h) {
+            for (int k = 0; k < 2; ++k) {
+                out[4 * h + 2 * k] = _mm_unpacklo_epi32(b[4 * h + k], b[4 * h + 2 + k]);
+                out[4 * h + 2 * k + 1] = _mm_unpackhi_epi32(b[4 * h + k], b[4 * h + 2 + k]);
+            }
+        }
+    }
+}
+
+/** Multiply one block of 16 elements. */
+template<int SIZE> inline void MulBlock(const unsigned char* tables, int bytes, const unsigned char* src, unsigned char* dst, bool add)
+{
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    __m128i data[SIZE], planes[SIZE], nibbles[2 * SIZE];
+    for (int i = 0; i < SIZE; ++i) data[i] = _mm_loadu_si128((const __m128i*)(src + 16 * i));
+    ToPlanes<SIZE>(data, planes);
+    for (int p = 0; p < bytes; ++p) {
+        nibbles[2 * p] = _mm_and_si128(planes[p], mask);
+        nibbles[2 * p + 1] = _mm_and_si128(_mm_srli_epi16(planes[p], 4), mask);
+    }
+    for (int j = 0; j < SIZE; ++j) {
+        __m128i acc = _mm_setzero_si128();
+        if (j < bytes) {
+            for (int k = 0; k < 2 * bytes; ++k) {
+                __m128i table = _mm_loadu_si128((const __m128i*)(tables + (k * bytes + j) * 16));
+                acc = _mm_xor_si128(acc, _mm_shuffle_epi8(table, nibbles[k]));
+            }
+        }
+        planes[j] = acc;
+    }
+    FromPlanes<SIZE>(planes, data);
+    for (int i = 0; i < SIZE; ++i) {
+        if (add) data[i] = _mm_xor_si128(data[i], _mm_loadu_si128((const __m128i*)(dst + 16 * i)));
+        _mm_storeu_si128((__m128i*)(dst + 16 * i), data[i]);
+    }
+}
+
+template<int SIZE> void MulVec(const unsigned char* tables, int bytes, const unsigned char* src, unsigned char* dst, size_t n, bool add)
+{
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) MulBlock<SIZE>(tables, bytes, src + i * SIZE, dst + i * SIZE, add);
+    if (i < n) {
+        // Pad the last partial block with zeroes.
+        unsigned char tmp_src[16 * SIZE] = {0}, tmp_dst[16 * SIZE] = {0};
+        memcpy(tmp_src, src + i * SIZE, (n - i) * SIZE);
+        if (add) memcpy(tmp_dst, dst + i * SIZE, (n - i) * SIZE);
+        MulBlock<SIZE>(tables, bytes, tmp_src, tmp_dst, add);
+        memcpy(dst + i * SIZE, tmp_dst, (n - i) * SIZE);
+    }
+}
+
+}
+
+void NibbleMulVecSSSE3(const unsigned char* tables, int elem_size, int bytes, const void* src, void* dst, size_t n, bool add)
+{
+    const unsigned char* s = static_cast<const unsigned char*>(src);
+    unsigned char* d = static_cast<unsigned char*>(dst);
+    switch (elem_size) {
+    case 1: MulVec<1>(tables, bytes, s, d, n, add); break;
+    case 2: MulVec<2>(tables, bytes, s, d, n, add); break;
+    case 4: MulVec<4>(tables, bytes, s, d, n, add); break;
+    case 8: MulVec<8>(tables, bytes, s, d, n, add); break;
+    }
+}
@@ -0,0 +1,67 @@
+/**********************************************************************
+ * Copyright (c) 2026 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#include "../fielddefines.h"
+
+#if defined(ENABLE_FIELD_INT_16) || defined(ENABLE_FIELD_INT_32) || defined(ENABLE_FIELD_INT_48) || defined(ENABLE_FIELD_INT_64)
+
+#include "tower_common_impl.h"
+
+#include "../lintrans.h"
+#include "../sketch_impl.h"
+
+#endif
+
+#include "../sketch.h"
+
+namespace {
+#ifdef ENABLE_FIELD_INT_16
+// 16 bit field, with wire modulus x^16 + x^5 + x^3 + x + 1
+typedef RecLinTrans<uint16_t, 6, 5, 5> StatTable16;
+typedef RecLinTrans<uint16_t, 4, 4, 4, 4> DynTable16;
+typedef TowerField<uint16_t, 16, 43, StatTable16, DynTable16> TowerField16;
+#endif
+
+#ifdef ENABLE_FIELD_INT_32
+// 32 bit field, with wire modulus x^32 + x^7 + x^3 + x^2 + 1
+typedef RecLinTrans<uint32_t, 6, 6, 5, 5, 5, 5> StatTable32;
+typedef RecLinTrans<uint32_t, 4, 4, 4, 4, 4, 4, 4, 4> DynTable32;
+typedef TowerField<uint32_t, 32, 141, StatTable32, DynTable32> TowerField32;
+#endif
+
+#ifdef ENABLE_FIELD_INT_48
+// 48 bit field, with wire modulus x^48 + x^5 + x^3 + x^2 + 1
+typedef RecLinTrans<uint64_t, 6, 6, 6, 6, 6, 6, 6, 6> StatTable48;
+typedef RecLinTrans<uint64_t, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4> DynTable48;
+typedef TowerField<uint64_t, 48, 45, StatTable48, DynTable48> TowerField48;
+#endif
+
+#ifdef ENABLE_FIELD_INT_64
+// 64 bit field, with wire modulus x^64 + x^4 + x^3 + x + 1
+typedef RecLinTrans<uint64_t, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5> StatTable64;
+typedef RecLinTrans<uint64_t, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4> DynTable64;
+typedef TowerField<uint64_t, 64, 27, StatTable64, DynTable64> TowerField64;
+#endif
+}
+
+Sketch* ConstructTower(int bits, int implementation)
+{
+    switch (bits) {
+#ifdef ENABLE_FIELD_INT_16
+    case 16: return new SketchImpl<TowerField16>(implementation, 16);
+#endif
+#ifdef ENABLE_FIELD_INT_32
+    case 32: return new SketchImpl<TowerField32>(implementation, 32);
+#endif
+#ifdef ENABLE_FIELD_INT_48
+    case 48: return new SketchImpl<TowerField48>(implementation, 48);
+#endif
+#ifdef ENABLE_FIELD_INT_64
+    case 64: return new SketchImpl<TowerField64>(implementation, 64);
+#endif
+    default: return nullptr;
+    }
+}
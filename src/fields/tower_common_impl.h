@@ -0,0 +1,457 @@
+/**********************************************************************
+ * Copyright (c) 2026 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef _MINISKETCH_FIELDS_TOWER_COMMON_IMPL_H_
+#define _MINISKETCH_FIELDS_TOWER_COMMON_IMPL_H_ 1
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "../int_utils.h"
+#include "../lintrans.h"
+#include "../sketch_impl.h"
+
+namespace {
+
+/* Tower field arithmetic.
+ *
+ * GF(2^16), GF(2^32) and GF(2^64) are built as a tower of quadratic extensions on top of GF(2^8):
+ * an element of GF(2^2k) is a1*y + a0 with a0, a1 in GF(2^k) (a0 in the low half of the integer),
+ * where y^2 = y + L_k. GF(2^8) itself uses log/exp tables. L_8 is any element with trace 1, and
+ * L_2k = L_k * y, which also has trace 1 (so y^2 + y + L_2k is irreducible), and makes multiplying
+ * by L_2k cost three multiplications by L_k rather than a full multiplication.
+ *
+ * Multiplication uses Karatsuba at every level, so a GF(2^64) product takes 27 GF(2^8) table
+ * multiplications plus 27 multiplications by L_8, with no loop over individual bits.
+ *
+ * GF(2^48) is a cubic extension of GF(2^16) instead: a2*z^2 + a1*z + a0 with z^3 = x, where x (the
+ * generator of GF(2^8)) is not a cube. A product takes 6 GF(2^16) multiplications (Karatsuba), and
+ * the reduction only multiplies GF(2^16) elements by x.
+ *
+ * This representation is not the polynomial basis used on the wire (and by the other
+ * implementations); TowerField converts using linear maps derived from a root of the wire modulus.
+ */
+
+template<typename I> struct TowerHalf;
+template<> struct TowerHalf<uint16_t> { typedef uint8_t type; };
+template<> struct TowerHalf<uint32_t> { typedef uint16_t type; };
+template<> struct TowerHalf<uint64_t> { typedef uint32_t type; };
+
+class TowerArith
+{
+    //! Logarithms base x of the nonzero elements of GF(2^8) = GF(2)[x]/(x^8 + x^4 + x^3 + x^2 + 1).
+    //! log[0] is 511, so that any product involving 0 lands in the zero part of exp.
+    uint16_t m_log[256];
+    uint8_t m_exp[1024];
+    //! Products with L_8, which every level of the tower multiplies by.
+    uint8_t m_mul_lambda[256];
+
+public:
+    TowerArith()
+    {
+        unsigned v = 1;
+        for (int i = 0; i < 1024; ++i) m_exp[i] = 0;
+        for (int i = 0; i < 255; ++i) {
+            m_exp[i] = m_exp[i + 255] = uint8_t(v);
+            m_log[v] = uint16_t(i);
+            v <<= 1;
+            if (v & 0x100) v ^= 0x11d;
+        }
+        m_log[0] = 511;
+        // Find the smallest element with trace 1.
+        for (unsigned c = 1; c < 256; ++c) {
+            uint8_t t = 0, p = uint8_t(c);
+            for (int i = 0; i < 8; ++i) {
+                t ^= p;
+                p = Mul(p, p);
+            }
+            if (t == 1) {
+                for (unsigned v = 0; v < 256; ++v) m_mul_lambda[v] = Mul(uint8_t(v), uint8_t(c));
+                break;
+            }
+        }
+    }
+
+    uint8_t Mul(uint8_t a, uint8_t b) const { return m_exp[m_log[a] + m_log[b]]; }
+
+    template<typename I> I Mul(I a, I b) const
+    {
+        typedef typename TowerHalf<I>::type H;
+        static constexpr int S = 4 * sizeof(I);
+        H a0 = H(a), a1 = H(a >> S), b0 = H(b), b1 = H(b >> S);
+        H t0 = Mul(a0, b0), t1 = Mul(a1, b1), t2 = Mul(H(a0 ^ a1), H(b0 ^ b1));
+        return I(H(t0 ^ MulLambda(t1))) | I(I(H(t2 ^ t0)) << S);
+    }
+
+    /** Multiply by L_8. */
+    uint8_t MulLambda(uint8_t a) const { return m_mul_lambda[a]; }
+
+    /** Multiply by L_2k = L_k * y: a * y = (a0 + a1) * y + a1 * L_k. */
+    template<typename I> I MulLambda(I a) const
+    {
+        typedef typename TowerHalf<I>::type H;
+        static constexpr int S = 4 * sizeof(I);
+        H a0 = H(a), a1 = H(a >> S);
+        return I(MulLambda(MulLambda(a1))) | I(I(MulLambda(H(a0 ^ a1))) << S);
+    }
+
+    /** Multiply every C-sized part of a by the generator y of the field of C (over its half). */
+    template<typename C, typename I> I MulY(I a) const
+    {
+        typedef typename TowerHalf<C>::type H;
+        static constexpr int S = 4 * sizeof(C);
+        I ret = 0;
+        for (int i = 0; i < int(sizeof(I) / sizeof(C)); ++i) {
+            C c = C(a >> (2 * S * i));
+            H c0 = H(c), c1 = H(c >> S);
+            ret |= I(I(C(MulLambda(c1)) | C(C(H(c0 ^ c1)) << S)) << (2 * S * i));
+        }
+        return ret;
+    }
+
+    uint8_t Sqr(uint8_t a) const { return m_exp[2 * m_log[a]]; }
+
+    /** (a1 * y + a0)^2 = a1^2 * y + (a0^2 + L_k * a1^2). */
+    template<typename I> I Sqr(I a) const
+    {
+        typedef typename TowerHalf<I>::type H;
+        static constexpr int S = 4 * sizeof(I);
+        H s1 = Sqr(H(a >> S));
+        return I(H(Sqr(H(a)) ^ MulLambda(s1))) | I(I(s1) << S);
+    }
+
+    uint8_t Inv(uint8_t a) const { return m_exp[255 - m_log[a]]; }
+
+    /** 1 / (a1 * y + a0) = (a1 * y + a0 + a1) / N, with N = a0 * (a0 + a1) + L_k * a1^2 in the subfield. */
+    template<typename I> I Inv(I a) const
+    {
+        typedef typename TowerHalf<I>::type H;
+        static constexpr int S = 4 * sizeof(I);
+        H a0 = H(a), a1 = H(a >> S), s = H(a0 ^ a1);
+        H n = Inv(H(Mul(a0, s) ^ MulLambda(Sqr(a1))));
+        return I(Mul(s, n)) | I(I(Mul(a1, n)) << S);
+    }
+
+    /** Multiply an element of GF(2^16) by x, the generator of GF(2^8) (with logarithm 1). */
+    uint16_t MulX(uint16_t a) const { return uint16_t(m_exp[m_log[a & 0xff] + 1] | (m_exp[m_log[a >> 8] + 1] << 8)); }
+
+    uint64_t Mul48(uint64_t a, uint64_t b) const
+    {
+        uint16_t a0 = uint16_t(a), a1 = uint16_t(a >> 16), a2 = uint16_t(a >> 32);
+        uint16_t b0 = uint16_t(b), b1 = uint16_t(b >> 16), b2 = uint16_t(b >> 32);
+        uint16_t p0 = Mul(a0, b0), p1 = Mul(a1, b1), p2 = Mul(a2, b2);
+        uint16_t c1 = Mul(uint16_t(a0 ^ a1), uint16_t(b0 ^ b1)) ^ p0 ^ p1;
+        uint16_t c2 = Mul(uint16_t(a0 ^ a2), uint16_t(b0 ^ b2)) ^ p0 ^ p1 ^ p2;
+        uint16_t c3 = Mul(uint16_t(a1 ^ a2), uint16_t(b1 ^ b2)) ^ p1 ^ p2;
+        // Reduce c4*z^4 + c3*z^3 using z^3 = x.
+        return uint64_t(uint16_t(p0 ^ MulX(c3))) | (uint64_t(uint16_t(c1 ^ MulX(p2))) << 16) | (uint64_t(c2) << 32);
+    }
+
+    /** (a2*z^2 + a1*z + a0)*z = a1*z^2 + a0*z + x*a2. */
+    uint64_t MulZ48(uint64_t a) const { return uint64_t(MulX(uint16_t(a >> 32))) | ((a & 0xffffffff) << 16); }
+
+    /** (a2*z^2 + a1*z + a0)^2 = a1^2*z^2 + x*a2^2*z + a0^2. */
+    uint64_t Sqr48(uint64_t a) const
+    {
+        return uint64_t(Sqr(uint16_t(a))) | (uint64_t(MulX(Sqr(uint16_t(a >> 32)))) << 16) | (uint64_t(Sqr(uint16_t(a >> 16))) << 32);
+    }
+
+    /** The inverse is the first column of the adjugate of the multiplication matrix, divided by its determinant. */
+    uint64_t Inv48(uint64_t a) const
+    {
+        uint16_t a0 = uint16_t(a), a1 = uint16_t(a >> 16), a2 = uint16_t(a >> 32);
+        uint16_t c0 = Sqr(a0) ^ MulX(Mul(a1, a2));
+        uint16_t c1 = Mul(a0, a1) ^ MulX(Sqr(a2));
+        uint16_t c2 = Sqr(a1) ^ Mul(a0, a2);
+        uint16_t d = Inv(uint16_t(Mul(a0, c0) ^ MulX(uint16_t(Mul(a2, c1) ^ Mul(a1, c2)))));
+        return uint64_t(Mul(c0, d)) | (uint64_t(Mul(c1, d)) << 16) | (uint64_t(Mul(c2, d)) << 32);
+    }
+};
+
+/** Select the arithmetic for a B-bit tower field: the quadratic tower, or the cubic extension for 48 bits. */
+template<typename I, int B> struct TowerOps
+{
+    static I Mul(const TowerArith& arith, I a, I b) { return arith.Mul(a, b); }
+    static I Sqr(const TowerArith& arith, I a) { return arith.Sqr(a); }
+    static I Inv(const TowerArith& arith, I a) { return arith.Inv(a); }
+
+    /** Compute out[j] = a times the tower element with only bit 8*j set. That element is the product of
+     *  the generators y of GF(2^16), GF(2^32) and GF(2^64) selected by the bits of j. */
+    static void ByteMultiples(const TowerArith& arith, I a, I* out)
+    {
+        out[0] = a;
+        for (int j = 1; j < B / 8; ++j) {
+            int low = j & -j;
+            if (low == 1) out[j] = arith.template MulY<uint16_t>(out[j - 1]);
+            if (low == 2) out[j] = arith.template MulY<uint32_t>(out[j - 2]);
+            if (low == 4) out[j] = arith.template MulY<uint64_t>(out[j - 4]);
+        }
+    }
+};
+
+template<> struct TowerOps<uint64_t, 48>
+{
+    static uint64_t Mul(const TowerArith& arith, uint64_t a, uint64_t b) { return arith.Mul48(a, b); }
+    static uint64_t Sqr(const TowerArith& arith, uint64_t a) { return arith.Sqr48(a); }
+    static uint64_t Inv(const TowerArith& arith, uint64_t a) { return arith.Inv48(a); }
+
+    /** Bytes 2*c and 2*c+1 hold the coefficient of z^c, so their basis elements are z^c and y*z^c. */
+    static void ByteMultiples(const TowerArith& arith, uint64_t a, uint64_t* out)
+    {
+        out[0] = a;
+        for (int j = 1; j < 6; ++j) out[j] = (j & 1) ? arith.MulY<uint16_t>(out[j - 1]) : arith.MulZ48(out[j - 2]);
+    }
+};
+
+/** The shared GF(2^8) tables (built on first use). */
+inline const TowerArith& GetTowerArith()
+{
+    static const TowerArith arith;
+    return arith;
+}
+
+/** Find x with XOR of images[j] for all bits j set in x equal to target, using Gaussian elimination. */
+template<typename I, int B> bool SolveLinear(const I* images, I target, I& solution)
+{
+    I rows[B] = {0}, combos[B] = {0};
+    for (int j = 0; j < B; ++j) {
+        I row = images[j], combo = I(I(1) << j);
+        for (int bit = B - 1; bit >= 0; --bit) {
+            if (!((row >> bit) & 1)) continue;
+            if (!rows[bit]) {
+                rows[bit] = row;
+                combos[bit] = combo;
+                break;
+            }
+            row ^= rows[bit];
+            combo ^= combos[bit];
+        }
+    }
+    solution = 0;
+    for (int bit = B - 1; bit >= 0; --bit) {
+        if (!((target >> bit) & 1)) continue;
+        if (!rows[bit]) return false;
+        target ^= rows[bit];
+        solution ^= combos[bit];
+    }
+    return true;
+}
+
+/** Multiply every byte of a by x in GF(2^8). The bytes are the coordinates over GF(2^8) in the tower. */
+template<typename I> inline I MulBytesX(I a)
+{
+    static constexpr I ONES = I(~I(0)) / 255;
+    return I((I(a << 1) & I(ONES * 0xfe)) ^ (I((a >> 7) & ONES) * 0x1d));
+}
+
+/** Tower field arithmetic on integers, in the tower representation. Mul2 multiplies by gen.
+ *
+ * StatTable is used for the fixed linear maps, DynTable for multiplication by a constant.
+ */
+template<typename I, int B, typename StatTable, typename DynTable> class TowerCore
+{
+protected:
+    typedef BitsInt<I, B> O;
+    typedef TowerOps<I, B> Ops;
+
+    const TowerArith* m_arith;
+    const StatTable* m_sqr;
+    const StatTable* m_qrt;
+    I m_gen;
+
+public:
+    typedef I Elem;
+    constexpr int Bits() const { return B; }
+
+    TowerCore(const TowerArith* arith, const StatTable* sqr, const StatTable* qrt, I gen) : m_arith(arith), m_sqr(sqr), m_qrt(qrt), m_gen(gen) {}
+
+    inline Elem Mul2(Elem val) const { return Ops::Mul(*m_arith, val, m_gen); }
+
+    class Multiplier
+    {
+        DynTable table;
+
+        static DynTable Build(const TowerCore& field, Elem a)
+        {
+            // Multiplying by a is GF(2^8)-linear, so the images of the other bits of every byte follow from the
+            // first by multiplying with x.
+            I images[B], bytes[B / 8];
+            Ops::ByteMultiples(*field.m_arith, a, bytes);
+            for (int byte = 0; byte < B / 8; ++byte) {
+                I val = bytes[byte];
+                for (int bit = 0; bit < 8; ++bit) {
+                    images[8 * byte + bit] = val;
+                    val = MulBytesX(val);
+                }
+            }
+            return DynTable(images);
+        }
+
+    public:
+        explicit Multiplier(const TowerCore& field, Elem a) : table(Build(field, a)) {}
+        constexpr inline Elem operator()(Elem a) const { return table.template Map<O>(a); }
+    };
+
+    inline Elem Mul(Elem a, Elem b) const { return Ops::Mul(*m_arith, a, b); }
+
+    /** Compute dst[i] = a*src[i] for i in [0,n). src and dst may be equal, or dst may start at least 16 elements
+     *  after src (elements are processed in increasing order). */
+    void MulVec(Elem a, const Elem* src, Elem* dst, size_t n) const
+    {
+        Multiplier mul(*this, a);
+        for (size_t i = 0; i < n; ++i) dst[i] = mul(src[i]);
+    }
+
+    /** Compute dst[i] ^= a*src[i] for i in [0,n). */
+    void AxpyVec(Elem a, const Elem* src, Elem* dst, size_t n) const
+    {
+        Multiplier mul(*this, a);
+        for (size_t i = 0; i < n; ++i) dst[i] ^= mul(src[i]);
+    }
+
+    /** Compute the square of a. */
+    inline Elem Sqr(Elem a) const { return m_sqr->template Map<O>(a); }
+
+    /** Compute x such that x^2 + x = a (undefined result if no solution exists). */
+    inline Elem Qrt(Elem a) const { return m_qrt->template Map<O>(a); }
+
+    /** Compute the inverse of x1. */
+    Elem Inv(Elem a) const { return a ? Ops::Inv(*m_arith, a) : a; }
+
+    /** Replace each of vals[0..n) (which must be nonzero) by its inverse, using one inversion and 3(n-1)
+     *  multiplications (Montgomery's trick). tmp must have room for n elements. */
+    void InvVec(Elem* vals, Elem* tmp, size_t n) const
+    {
+        if (n == 0) return;
+        tmp[0] = vals[0];
+        for (size_t i = 1; i < n; ++i) tmp[i] = Mul(tmp[i - 1], vals[i]);
+        Elem inv = Inv(tmp[n - 1]);
+        for (size_t i = n - 1; i > 0; --i) {
+            Elem val = vals[i];
+            vals[i] = Mul(inv, tmp[i - 1]);
+            inv = Mul(inv, val);
+        }
+        vals[0] = inv;
+    }
+};
+
+/** The linear maps needed by TowerField, computed once per field. */
+template<typename I, int B, typename StatTable, typename DynTable> struct TowerTables
+{
+    //! x -> x^2, and x -> a root of x^2 + x + a.
+    StatTable sqr, qrt;
+    //! Wire (polynomial basis) to tower representation, and back.
+    StatTable load, save;
+    //! The image of x, a root of the wire modulus in the tower representation.
+    I root;
+
+    explicit TowerTables(uint64_t mod)
+    {
+        typedef TowerOps<I, B> Ops;
+        const TowerArith& arith = GetTowerArith();
+        I images[B], sol;
+
+        // qrt: x^2 + x is linear with kernel {0, 1}, and its image is the elements with trace 0. Solve for
+        // every basis vector; those with trace 1 (no solution) are mapped like their sum with the first such
+        // basis vector, which maps to 0. This is correct on every element with trace 0.
+        I sqr_images[B], sqrplus[B], qrt_images[B];
+        for (int i = 0; i < B; ++i) {
+            sqr_images[i] = Ops::Sqr(arith, I(I(1) << i));
+            sqrplus[i] = I(sqr_images[i] ^ (I(1) << i));
+        }
+        sqr = StatTable(sqr_images);
+        int first_odd = -1;
+        for (int i = 0; i < B; ++i) {
+            if (SolveLinear<I, B>(sqrplus, I(I(1) << i), sol)) {
+                qrt_images[i] = sol;
+            } else if (first_odd == -1) {
+                first_odd = i;
+                qrt_images[i] = 0;
+            } else {
+                SolveLinear<I, B>(sqrplus, I((I(1) << i) ^ (I(1) << first_odd)), sol);
+                qrt_images[i] = sol;
+            }
+        }
+        qrt = StatTable(qrt_images);
+
+        // Find a root of the wire modulus x^B + mod. The root finding needs Mul2 to multiply by an element
+        // that lies in no proper subfield, i.e. in no GF(2^(B/p)) for a prime p dividing B. In the quadratic
+        // towers, every value below 2^(B/2) is in GF(2^(B/2)), so start the search above that.
+        auto in_subfield = [&](I val, int bits) {
+            I pow = val;
+            for (int i = 0; i < bits; ++i) pow = Ops::Sqr(arith, pow);
+            return pow == val;
+        };
+        I gen = I(I(1) << (B / 2));
+        while (in_subfield(gen, B / 2) || (B % 3 == 0 && in_subfield(gen, B / 3))) ++gen;
+        TowerCore<I, B, StatTable, DynTable> core(&arith, &sqr, &qrt, gen);
+        std::vector<I> poly(B + 1);
+        for (int i = 0; i < B; ++i) poly[i] = (mod >> i) & 1;
+        poly[B] = 1;
+        std::vector<I> roots = FindRoots(poly, gen, core);
+        root = *std::min_element(roots.begin(), roots.end());
+
+        // load maps x^i to root^i; save is its inverse.
+        I pow = 1;
+        for (int i = 0; i < B; ++i) {
+            images[i] = pow;
+            pow = Ops::Mul(arith, pow, root);
+        }
+        load = StatTable(images);
+        I save_images[B];
+        for (int i = 0; i < B; ++i) {
+            SolveLinear<I, B>(images, I(I(1) << i), sol);
+            save_images[i] = sol;
+        }
+        save = StatTable(save_images);
+    }
+};
+
+/** Tower field implementation, for fields of 16, 32, 48 or 64 bits whose wire modulus is x^B + MOD. */
+template<typename I, int B, uint64_t MOD, typename StatTable, typename DynTable> class TowerField : public TowerCore<I, B, StatTable, DynTable>
+{
+    typedef TowerCore<I, B, StatTable, DynTable> Core;
+    typedef TowerTables<I, B, StatTable, DynTable> Tables;
+    using typename Core::O;
+
+    static const Tables& GetTables()
+    {
+        static const Tables tables(MOD);
+        return tables;
+    }
+
+    const Tables& m_tables;
+
+public:
+    typedef I Elem;
+
+    TowerField() : Core(&GetTowerArith(), &GetTables().sqr, &GetTables().qrt, GetTables().root), m_tables(GetTables()) {}
+
+    /** Generate a random field element. */
+    Elem FromSeed(uint64_t seed) const {
+        uint64_t k0 = 0x546f776572466c64ull; // "TowerFld"
+        uint64_t k1 = seed;
+        uint64_t count = ((uint64_t)B) << 32;
+        Elem ret;
+        do {
+            ret = O::Mask(I(SipHash(k0, k1, count++)));
+        } while(ret == 0);
+        return ret;
+    }
+
+    Elem Deserialize(BitReader& in) const { return m_tables.load.template Map<O>(in.template Read<B, I>()); }
+
+    void Serialize(BitWriter& out, Elem val) const { out.template Write<B, I>(m_tables.save.template Map<O>(val)); }
+
+    Elem FromUint64(uint64_t x) const { return m_tables.load.template Map<O>(O::Mask(I(x))); }
+    uint64_t ToUint64(Elem val) const { return uint64_t(m_tables.save.template Map<O>(val)); }
+};
+
+}
+
+#endif
@@ -0,0 +1,347 @@
+/**********************************************************************
+ * Copyright (c) 2018 Pieter Wuille, Greg Maxwell, Gleb Naumenko      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef _MINISKETCH_FIELDS_WIDE_COMMON_IMPL_H_
+#define _MINISKETCH_FIELDS_WIDE_COMMON_IMPL_H_ 1
+
+#include <stdint.h>
+
+#include "../int_utils.h"
+
+namespace {
+
+/** An element of a field of 65 to 128 bits, as two 64-bit limbs (least significant first).
+ *
+ * It converts implicitly from integers, so that the sketch algorithms can compare it with and assign
+ * it small constants like they do for integer element types.
+ */
+struct UInt128
+{
+    uint64_t lo, hi;
+
+    constexpr UInt128(uint64_t val = 0) : lo(val), hi(0) {}
+    constexpr UInt128(uint64_t l, uint64_t h) : lo(l), hi(h) {}
+
+    friend constexpr bool operator==(const UInt128& a, const UInt128& b) { return a.lo == b.lo && a.hi == b.hi; }
+    friend constexpr bool operator!=(const UInt128& a, const UInt128& b) { return a.lo != b.lo || a.hi != b.hi; }
+    friend constexpr UInt128 operator^(const UInt128& a, const UInt128& b) { return UInt128(a.lo ^ b.lo, a.hi ^ b.hi); }
+    UInt128& operator^=(const UInt128& b) { lo ^= b.lo; hi ^= b.hi; return *this; }
+};
+
+/** Carry-less 64x64 bit products without special instructions.
+ *
+ * Products use a 4-bit window over one operand, with a table of multiples of the other one. That table
+ * can be built once (as Multiples) when the same value is multiplied by many others.
+ */
+struct WideGenericMul
+{
+    /** The 128-bit products of a value with every 4-bit value, as (lo, hi) pairs. */
+    struct Multiples
+    {
+        uint64_t lo[16], hi[16];
+
+        explicit Multiples(uint64_t a)
+        {
+            lo[0] = 0;
+            hi[0] = 0;
+            lo[1] = a;
+            hi[1] = 0;
+            for (int i = 2; i < 16; i += 2) {
+                lo[i] = lo[i / 2] << 1;
+                hi[i] = (hi[i / 2] << 1) | (lo[i / 2] >> 63);
+                lo[i + 1] = lo[i] ^ a;
+                hi[i + 1] = hi[i];
+            }
+        }
+    };
+
+    /** Compute the 128-bit product of a and b as (lo, hi). */
+    static inline void Mul(const Multiples& a, uint64_t b, uint64_t& lo, uint64_t& hi)
+    {
+        lo = a.lo[b >> 60];
+        hi = a.hi[b >> 60];
+        for (int i = 56; i >= 0; i -= 4) {
+            hi = (hi << 4) | (lo >> 60);
+            lo <<= 4;
+            lo ^= a.lo[(b >> i) & 15];
+            hi ^= a.hi[(b >> i) & 15];
+        }
+    }
+
+    /** Spread the 32 bits of x over the even bit positions of the result. */
+    static inline uint64_t Spread(uint64_t x)
+    {
+        x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+        x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+        x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        x = (x | (x << 2)) & 0x3333333333333333ULL;
+        return (x | (x << 1)) & 0x5555555555555555ULL;
+    }
+
+    /** Compute the 128-bit square of a as (lo, hi). */
+    static inline void Sqr(uint64_t a, uint64_t& lo, uint64_t& hi)
+    {
+        lo = Spread(a & 0xFFFFFFFF);
+        hi = Spread(a >> 32);
+    }
+};
+
+/** Compute the position of the lowest set bit of x (which must be nonzero). */
+constexpr int LowestBit(uint64_t x) { return (x & 1) ? 0 : 1 + LowestBit(x >> 1); }
+
+/** Compute (lo, hi) >> S, truncated to 64 bits, for 1 <= S <= 64. */
+template<int S> inline uint64_t ShiftRightPair(uint64_t lo, uint64_t hi)
+{
+    return S == 64 ? hi : (lo >> (S & 63)) | (hi << ((64 - S) & 63));
+}
+
+/** Add the product of the 128-bit polynomial (h0, h1) and the sparse polynomial M to (r0, r1, r2),
+ *  with one shift per set bit of M. */
+template<uint64_t M> struct ShiftXorMul
+{
+    static constexpr int S = LowestBit(M);
+
+    static inline void Run(uint64_t h0, uint64_t h1, uint64_t& r0, uint64_t& r1, uint64_t& r2)
+    {
+        r0 ^= h0 << S;
+        r1 ^= (h1 << S) | (S ? h0 >> ((64 - S) & 63) : 0);
+        r2 ^= S ? h1 >> ((64 - S) & 63) : 0;
+        ShiftXorMul<M & (M - 1)>::Run(h0, h1, r0, r1, r2);
+    }
+};
+
+template<> struct ShiftXorMul<0>
+{
+    static inline void Run(uint64_t, uint64_t, uint64_t&, uint64_t&, uint64_t&) {}
+};
+
+/** Reduce the polynomial (p0, p1, p2, p3) of degree below 2B-1 modulo x^B + MOD.
+ *
+ * All moduli for these sizes are trinomials or pentanomials whose other terms have degree below B/2,
+ * so two rounds of folding the part above x^B back with shifts suffice.
+ */
+template<int B, uint64_t MOD> inline UInt128 ReduceWide(uint64_t p0, uint64_t p1, uint64_t p2, uint64_t p3)
+{
+    static constexpr int S = B - 64;
+    static constexpr uint64_t HIMASK = (~uint64_t{0}) >> (64 - S);
+    uint64_t h0 = ShiftRightPair<S>(p1, p2), h1 = ShiftRightPair<S>(p2, p3);
+    uint64_t t0 = 0, t1 = 0, t2 = 0;
+    ShiftXorMul<MOD>::Run(h0, h1, t0, t1, t2);
+    uint64_t u0 = 0, u1 = 0, u2 = 0;
+    ShiftXorMul<MOD>::Run(ShiftRightPair<S>(t1, t2), 0, u0, u1, u2);
+    return UInt128(p0 ^ t0 ^ u0, (p1 ^ t1 ^ u1) & HIMASK);
+}
+
+/** Implementation of fields of 65 to 128 bits, in the same polynomial basis as the serialized form.
+ *
+ * C provides carry-less 64x64 bit multiplication and squaring; full products use Karatsuba (three
+ * limb products). The table for solving x^2 + x = a is computed once per field size on first use.
+ */
+template<int B, uint64_t MOD, typename C> class WideField
+{
+    static_assert(B > 64 && B <= 128, "WideField requires 64 < B <= 128");
+
+public:
+    typedef UInt128 Elem;
+
+private:
+    static constexpr uint64_t HIMASK = (~uint64_t{0}) >> (128 - B);
+
+    /** Solution of x^2 + x = e_i for every basis element e_i (adjusted for those with trace 1). */
+    struct QrtTable
+    {
+        Elem map[B];
+
+        QrtTable()
+        {
+            // Reduce the images of x^2 + x of all basis elements to row echelon form, tracking which
+            // inputs every row is the image of. The image is the (B-1)-dimensional subspace of trace 0.
+            Elem rows[B], combs[B];
+            bool used[B] = {};
+            for (int i = 0; i < B; ++i) {
+                Elem row = Sqr(Unit(i)) ^ Unit(i), comb = Unit(i);
+                int top = Reduce(rows, combs, used, row, comb);
+                if (top >= 0) {
+                    rows[top] = row;
+                    combs[top] = comb;
+                    used[top] = true;
+                }
+            }
+            // Pick one basis element with trace 1 and map it to 0; for the others, solve with it added,
+            // so that the contributions cancel for every input of trace 0.
+            int odd = -1;
+            for (int i = 0; i < B && odd < 0; ++i) {
+                Elem row = Unit(i), comb = 0;
+                if (Reduce(rows, combs, used, row, comb) >= 0) odd = i;
+            }
+            for (int i = 0; i < B; ++i) {
+                Elem row = Unit(i), comb = 0;
+                if (Reduce(rows, combs, used, row, comb) >= 0) {
+                    row = Unit(i) ^ Unit(odd);
+                    comb = 0;
+                    Reduce(rows, combs, used, row, comb);
+                }
+                map[i] = i == odd ? Elem(0) : comb;
+            }
+        }
+
+        static Elem Unit(int i) { return i < 64 ? Elem(uint64_t{1} << i, 0) : Elem(0, uint64_t{1} << (i - 64)); }
+
+        /** Eliminate row against rows, updating comb alongside; return its top bit if nonzero, or -1. */
+        static int Reduce(const Elem* rows, const Elem* combs, const bool* used, Elem& row, Elem& comb)
+        {
+            for (int j = B - 1; j >= 0; --j) {
+                if ((((j < 64 ? row.lo >> j : row.hi >> (j - 64))) & 1) == 0) continue;
+                if (!used[j]) return j;
+                row ^= rows[j];
+                comb ^= combs[j];
+            }
+            return -1;
+        }
+    };
+
+    static const QrtTable& GetQrtTable()
+    {
+        static const QrtTable table;
+        return table;
+    }
+
+    const QrtTable* m_qrt;
+
+public:
+    WideField() : m_qrt(&GetQrtTable()) {}
+
+    inline int Bits() const { return B; }
+
+    static inline Elem Mul2(Elem val)
+    {
+        uint64_t top = (val.hi >> (B - 65)) & 1;
+        return Elem((val.lo << 1) ^ (MOD & -top), ((val.hi << 1) | (val.lo >> 63)) & HIMASK);
+    }
+
+    /** Multiplication by a fixed element, with the limb multiples that Karatsuba needs prepared once. */
+    class Multiplier
+    {
+        typename C::Multiples m_lo, m_hi, m_mid;
+    public:
+        inline explicit Multiplier(const WideField&, Elem a) : m_lo(a.lo), m_hi(a.hi), m_mid(a.lo ^ a.hi) {}
+        inline Elem operator()(Elem b) const
+        {
+            uint64_t z0l, z0h, z1l, z1h, z2l, z2h;
+            C::Mul(m_lo, b.lo, z0l, z0h);
+            C::Mul(m_hi, b.hi, z2l, z2h);
+            C::Mul(m_mid, b.lo ^ b.hi, z1l, z1h);
+            z1l ^= z0l ^ z2l;
+            z1h ^= z0h ^ z2h;
+            return ReduceWide<B, MOD>(z0l, z0h ^ z1l, z2l ^ z1h, z2h);
+        }
+    };
+
+    inline Elem Mul(Elem a, Elem b) const { return Multiplier(*this, a)(b); }
+
+    /** Compute dst[i] = a*src[i] for i in [0,n). */
+    inline void MulVec(Elem a, const Elem* src, Elem* dst, size_t n) const
+    {
+        Multiplier mul(*this, a);
+        for (size_t i = 0; i < n; ++i) dst[i] = mul(src[i]);
+    }
+
+    /** Compute dst[i] ^= a*src[i] for i in [0,n). */
+    inline void AxpyVec(Elem a, const Elem* src, Elem* dst, size_t n) const
+    {
+        Multiplier mul(*this, a);
+        for (size_t i = 0; i < n; ++i) dst[i] ^= mul(src[i]);
+    }
+
+    static inline Elem Sqr(Elem val)
+    {
+        uint64_t s0, s1, s2, s3;
+        C::Sqr(val.lo, s0, s1);
+        C::Sqr(val.hi, s2, s3);
+        return ReduceWide<B, MOD>(s0, s1, s2, s3);
+    }
+
+    /** Compute x such that x^2 + x = a (undefined result if no solution exists). */
+    inline Elem Qrt(Elem val) const
+    {
+        Elem ret = 0;
+        for (int i = 0; i < B; ++i) {
+            uint64_t mask = -((i < 64 ? val.lo >> i : val.hi >> (i - 64)) & 1);
+            ret.lo ^= m_qrt->map[i].lo & mask;
+            ret.hi ^= m_qrt->map[i].hi & mask;
+        }
+        return ret;
+    }
+
+    /** Compute the inverse of x1, as x1^(2^B - 2) (Itoh-Tsujii). */
+    Elem Inv(Elem val) const
+    {
+        // Invariant: r = val^(2^k - 1), with k following the binary expansion of B - 1.
+        Elem r = val;
+        int k = 1;
+        int top = 0;
+        while ((B - 1) >> (top + 1)) ++top;
+        for (int i = top - 1; i >= 0; --i) {
+            Elem t = r;
+            for (int j = 0; j < k; ++j) t = Sqr(t);
+            r = Mul(r, t);
+            k *= 2;
+            if (((B - 1) >> i) & 1) {
+                r = Mul(Sqr(r), val);
+                ++k;
+            }
+        }
+        return Sqr(r);
+    }
+
+    /** Replace each of vals[0..n) (which must be nonzero) by its inverse, using one inversion and 3(n-1)
+     *  multiplications (Montgomery's trick). tmp must have room for n elements. */
+    void InvVec(Elem* vals, Elem* tmp, size_t n) const
+    {
+        if (n == 0) return;
+        tmp[0] = vals[0];
+        for (size_t i = 1; i < n; ++i) tmp[i] = Mul(tmp[i - 1], vals[i]);
+        Elem inv = Inv(tmp[n - 1]);
+        for (size_t i = n - 1; i > 0; --i) {
+            Elem val = vals[i];
+            vals[i] = Mul(inv, tmp[i - 1]);
+            inv = Mul(inv, val);
+        }
+        vals[0] = inv;
+    }
+
+    /** Generate a random field element. */
+    Elem FromSeed(uint64_t seed) const {
+        uint64_t k0 = 0x4269674669656c64ull; // "BigField"
+        uint64_t k1 = seed;
+        uint64_t count = ((uint64_t)B) << 32;
+        Elem ret;
+        do {
+            ret.lo = SipHash(k0, k1, count++);
+            ret.hi = SipHash(k0, k1, count++) & HIMASK;
+        } while(ret == 0);
+        return ret;
+    }
+
+    Elem Deserialize(BitReader& in) const {
+        Elem ret;
+        ret.lo = in.Read<64, uint64_t>();
+        ret.hi = in.Read<B - 64, uint64_t>();
+        return ret;
+    }
+
+    void Serialize(BitWriter& out, Elem val) const {
+        out.Write<64, uint64_t>(val.lo);
+        out.Write<B - 64, uint64_t>(val.hi);
+    }
+
+    Elem FromUint64(uint64_t x) const { return Elem(x); }
+    uint64_t ToUint64(Elem val) const { return val.lo; }
+};
+
+}
+
+#endif
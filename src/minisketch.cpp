@@ -5,7 +5,12 @@
  **********************************************************************/
 
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <new>
+#include <random>
+#include <vector>
 
 #define MINISKETCH_BUILD
 #ifdef _MINISKETCH_H_
@@ -13,8 +18,10 @@
 #endif
 #include "../include/minisketch.h"
 
+#include "decode_cache.h"
 #include "false_positives.h"
 #include "fielddefines.h"
+#include "int_utils.h"
 #include "sketch.h"
 
 #ifdef HAVE_CLMUL
@@ -33,6 +40,15 @@ Sketch* ConstructGeneric5Bytes(int bits, int implementation);
 Sketch* ConstructGeneric6Bytes(int bits, int implementation);
 Sketch* ConstructGeneric7Bytes(int bits, int implementation);
 Sketch* ConstructGeneric8Bytes(int bits, int implementation);
+Sketch* ConstructGeneric9Bytes(int bits, int implementation);
+Sketch* ConstructGeneric10Bytes(int bits, int implementation);
+Sketch* ConstructGeneric11Bytes(int bits, int implementation);
+Sketch* ConstructGeneric12Bytes(int bits, int implementation);
+Sketch* ConstructGeneric13Bytes(int bits, int implementation);
+Sketch* ConstructGeneric14Bytes(int bits, int implementation);
+Sketch* ConstructGeneric15Bytes(int bits, int implementation);
+Sketch* ConstructGeneric16Bytes(int bits, int implementation);
+Sketch* ConstructTower(int bits, int implementation);
 
 #ifdef HAVE_CLMUL
 Sketch* ConstructClMul1Byte(int bits, int implementation);
@@ -43,6 +59,14 @@ Sketch* ConstructClMul5Bytes(int bits, int implementation);
 Sketch* ConstructClMul6Bytes(int bits, int implementation);
 Sketch* ConstructClMul7Bytes(int bits, int implementation);
 Sketch* ConstructClMul8Bytes(int bits, int implementation);
+Sketch* ConstructClMul9Bytes(int bits, int implementation);
+Sketch* ConstructClMul10Bytes(int bits, int implementation);
+Sketch* ConstructClMul11Bytes(int bits, int implementation);
+Sketch* ConstructClMul12Bytes(int bits, int implementation);
+Sketch* ConstructClMul13Bytes(int bits, int implementation);
+Sketch* ConstructClMul14Bytes(int bits, int implementation);
+Sketch* ConstructClMul15Bytes(int bits, int implementation);
+Sketch* ConstructClMul16Bytes(int bits, int implementation);
 Sketch* ConstructClMulTri1Byte(int bits, int implementation);
 Sketch* ConstructClMulTri2Bytes(int bits, int implementation);
 Sketch* ConstructClMulTri3Bytes(int bits, int implementation);
@@ -55,12 +79,13 @@ Sketch* ConstructClMulTri8Bytes(int bits, int implementation);
 
 namespace {
 
+//! Implementation numbers are the same in every build; CLMUL ones are unavailable without HAVE_CLMUL.
 enum class FieldImpl {
     GENERIC = 0,
-#ifdef HAVE_CLMUL
     CLMUL,
     CLMUL_TRI,
-#endif
+    TOWER,
+    COUNT
 };
 
 #ifdef HAVE_CLMUL
@@ -77,87 +102,215 @@ static inline bool EnableClmul()
 }
 #endif
 
-Sketch* Construct(int bits, int impl)
+/** Per-thread random generator: SipHash in counter mode, keyed from std::random_device once.
+ *
+ * Outputs are computed in batches, which lets the independent hashes overlap.
+ */
+class SeedGenerator
 {
-    switch (FieldImpl(impl)) {
-    case FieldImpl::GENERIC:
-        switch ((bits + 7) / 8) {
-        case 1:
-            return ConstructGeneric1Byte(bits, impl);
-        case 2:
-            return ConstructGeneric2Bytes(bits, impl);
-        case 3:
-            return ConstructGeneric3Bytes(bits, impl);
-        case 4:
-            return ConstructGeneric4Bytes(bits, impl);
-        case 5:
-            return ConstructGeneric5Bytes(bits, impl);
-        case 6:
-            return ConstructGeneric6Bytes(bits, impl);
-        case 7:
-            return ConstructGeneric7Bytes(bits, impl);
-        case 8:
-            return ConstructGeneric8Bytes(bits, impl);
-        default:
-            return nullptr;
+    static constexpr int BATCH = 32;
+    uint64_t m_k0, m_k1;
+    uint64_t m_counter = 0;
+    uint64_t m_buffer[BATCH];
+    int m_pos = BATCH;
+
+public:
+    SeedGenerator()
+    {
+        std::random_device rng;
+        std::uniform_int_distribution<uint64_t> dist;
+        m_k0 = dist(rng);
+        m_k1 = dist(rng);
+    }
+
+    uint64_t Next()
+    {
+        if (m_pos == BATCH) {
+            for (int i = 0; i < BATCH; ++i) m_buffer[i] = SipHash(m_k0, m_k1, m_counter++);
+            m_pos = 0;
         }
-        break;
+        return m_buffer[m_pos++];
+    }
+};
+
+typedef Sketch* (*ConstructFn)(int bits, int implementation);
+
+/** Constructors per implementation and element size in bytes.
+ *
+ * Built once, so that CPU feature detection is not repeated for every sketch created.
+ * Entries for implementations the CPU does not support are nullptr.
+ */
+struct ConstructorTable
+{
+    static constexpr int IMPLEMENTATIONS = int(FieldImpl::COUNT);
+    static constexpr int MAX_BYTES = 16;
+    ConstructFn fns[IMPLEMENTATIONS][MAX_BYTES] = {};
+
+    ConstructorTable()
+    {
+        const ConstructFn generic[MAX_BYTES] = {ConstructGeneric1Byte, ConstructGeneric2Bytes, ConstructGeneric3Bytes, ConstructGeneric4Bytes, ConstructGeneric5Bytes, ConstructGeneric6Bytes, ConstructGeneric7Bytes, ConstructGeneric8Bytes,
+            ConstructGeneric9Bytes, ConstructGeneric10Bytes, ConstructGeneric11Bytes, ConstructGeneric12Bytes, ConstructGeneric13Bytes, ConstructGeneric14Bytes, ConstructGeneric15Bytes, ConstructGeneric16Bytes};
+        std::copy(generic, generic + MAX_BYTES, fns[int(FieldImpl::GENERIC)]);
 #ifdef HAVE_CLMUL
-    case FieldImpl::CLMUL:
-        if (EnableClmul()) {
-            switch ((bits + 7) / 8) {
-            case 1:
-                return ConstructClMul1Byte(bits, impl);
-            case 2:
-                return ConstructClMul2Bytes(bits, impl);
-            case 3:
-                return ConstructClMul3Bytes(bits, impl);
-            case 4:
-                return ConstructClMul4Bytes(bits, impl);
-            case 5:
-                return ConstructClMul5Bytes(bits, impl);
-            case 6:
-                return ConstructClMul6Bytes(bits, impl);
-            case 7:
-                return ConstructClMul7Bytes(bits, impl);
-            case 8:
-                return ConstructClMul8Bytes(bits, impl);
-            default:
-                return nullptr;
-            }
+        const ConstructFn clmul[MAX_BYTES] = {ConstructClMul1Byte, ConstructClMul2Bytes, ConstructClMul3Bytes, ConstructClMul4Bytes, ConstructClMul5Bytes, ConstructClMul6Bytes, ConstructClMul7Bytes, ConstructClMul8Bytes,
+            ConstructClMul9Bytes, ConstructClMul10Bytes, ConstructClMul11Bytes, ConstructClMul12Bytes, ConstructClMul13Bytes, ConstructClMul14Bytes, ConstructClMul15Bytes, ConstructClMul16Bytes};
+        // Trinomial specializations exist for fields of up to 64 bits only.
+        const ConstructFn clmul_tri[8] = {ConstructClMulTri1Byte, ConstructClMulTri2Bytes, ConstructClMulTri3Bytes, ConstructClMulTri4Bytes, ConstructClMulTri5Bytes, ConstructClMulTri6Bytes, ConstructClMulTri7Bytes, ConstructClMulTri8Bytes};
+        bool enable_clmul = EnableClmul();
+        for (int i = 0; i < MAX_BYTES; ++i) {
+            fns[int(FieldImpl::CLMUL)][i] = enable_clmul ? clmul[i] : nullptr;
+            if (i < 8) fns[int(FieldImpl::CLMUL_TRI)][i] = enable_clmul ? clmul_tri[i] : nullptr;
         }
-        break;
-    case FieldImpl::CLMUL_TRI:
-        if (EnableClmul()) {
-            switch ((bits + 7) / 8) {
-            case 1:
-                return ConstructClMulTri1Byte(bits, impl);
-            case 2:
-                return ConstructClMulTri2Bytes(bits, impl);
-            case 3:
-                return ConstructClMulTri3Bytes(bits, impl);
-            case 4:
-                return ConstructClMulTri4Bytes(bits, impl);
-            case 5:
-                return ConstructClMulTri5Bytes(bits, impl);
-            case 6:
-                return ConstructClMulTri6Bytes(bits, impl);
-            case 7:
-                return ConstructClMulTri7Bytes(bits, impl);
-            case 8:
-                return ConstructClMulTri8Bytes(bits, impl);
-            default:
-                return nullptr;
-            }
-        }
-        break;
 #endif
+        // Tower fields exist for 16, 32, 48 and 64 bits only.
+        fns[int(FieldImpl::TOWER)][1] = ConstructTower;
+        fns[int(FieldImpl::TOWER)][3] = ConstructTower;
+        fns[int(FieldImpl::TOWER)][5] = ConstructTower;
+        fns[int(FieldImpl::TOWER)][7] = ConstructTower;
+    }
+};
+
+Sketch* Construct(int bits, int impl)
+{
+    static const ConstructorTable table;
+    int bytes = (bits + 7) / 8;
+    if (impl < 0 || impl >= ConstructorTable::IMPLEMENTATIONS || bytes < 1 || bytes > ConstructorTable::MAX_BYTES) return nullptr;
+    ConstructFn fn = table.fns[impl][bytes - 1];
+    return fn ? fn(bits, impl) : nullptr;
+}
+
+/** Measure how long a small add + decode workload takes with a given implementation (in ns), or -1 if unavailable. */
+int64_t TimeImplementation(uint32_t bits, int impl)
+{
+    static constexpr int CAPACITY = 32;
+    static constexpr int RUNS = 3;
+    int64_t best = -1;
+    Sketch* sketch = Construct(bits, impl);
+    if (!sketch) return -1;
+    sketch->Init(CAPACITY);
+    sketch->SetSeed(0);
+    uint64_t mask = bits >= 64 ? ~uint64_t{0} : (uint64_t{1} << bits) - 1;
+    std::vector<uint64_t> roots(CAPACITY);
+    for (int run = 0; run < RUNS; ++run) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < CAPACITY; ++i) {
+            uint64_t element = ((i + 1) * 0x9E3779B97F4A7C15ULL) & mask;
+            sketch->Add(element ? element : 1);
+        }
+        sketch->Decode(CAPACITY, roots.data(), false);
+        int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        if (best < 0 || elapsed < best) best = elapsed;
+    }
+    delete sketch;
+    return best;
+}
+
+/** Map MINISKETCH_IMPLEMENTATION_AUTO to the fastest implementation for a field size.
+ *
+ * The first time this is called for a given field size, every available implementation is
+ * timed; the result is remembered for the rest of the process.
+ */
+uint32_t ResolveImplementation(uint32_t bits, uint32_t implementation)
+{
+    if (implementation != MINISKETCH_IMPLEMENTATION_AUTO || bits > 128) return implementation;
+    static std::atomic<uint32_t> best_impl[129]; // Fastest implementation plus one, or 0 if not determined yet.
+    uint32_t cached = best_impl[bits].load(std::memory_order_relaxed);
+    if (cached) return cached - 1;
+    uint32_t best = 0;
+    int64_t best_time = -1;
+    for (uint32_t impl = 0; impl <= minisketch_implementation_max(); ++impl) {
+        int64_t time = TimeImplementation(bits, impl);
+        if (time >= 0 && (best_time < 0 || time < best_time)) {
+            best = impl;
+            best_time = time;
+        }
+    }
+    best_impl[bits].store(best + 1, std::memory_order_relaxed);
+    return best;
+}
+
+/** Sort a list of elements of up to `bits` bits in increasing order.
+ *
+ * Large lists are sorted using an LSD radix sort, with the digit width chosen so
+ * that `bits` is split into as few passes as possible of at most 11 bits each
+ * (keeping the histogram within L1 cache). Passes in which all elements have the
+ * same digit are skipped.
+ */
+void SortElements(uint64_t* data, size_t count, int bits)
+{
+    if (count < 64) {
+        std::sort(data, data + count);
+        return;
+    }
+    const int passes = (bits + 10) / 11;
+    const int width = (bits + passes - 1) / passes;
+    const uint64_t mask = (uint64_t{1} << width) - 1;
+    std::vector<uint64_t> buffer(count);
+    std::vector<size_t> offsets(size_t{1} << width);
+    uint64_t* src = data;
+    uint64_t* dst = buffer.data();
+    for (int shift = 0; shift < bits; shift += width) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        for (size_t i = 0; i < count; ++i) ++offsets[(src[i] >> shift) & mask];
+        if (offsets[(src[0] >> shift) & mask] == count) continue;
+        size_t sum = 0;
+        for (auto& offset : offsets) {
+            size_t num = offset;
+            offset = sum;
+            sum += num;
+        }
+        for (size_t i = 0; i < count; ++i) dst[offsets[(src[i] >> shift) & mask]++] = src[i];
+        std::swap(src, dst);
+    }
+    if (src != data) std::copy(src, src + count, data);
+}
+
+DecodeCache& GetDecodeCache()
+{
+    static DecodeCache cache;
+    return cache;
+}
+
+/** Callback wrapper for minisketch_decode_callback that remembers the elements passed through it. */
+struct CollectingCallback
+{
+    void (*callback)(uint64_t, void*);
+    void* arg;
+    std::vector<uint64_t> elements;
+
+    static void Call(uint64_t element, void* state)
+    {
+        CollectingCallback* self = static_cast<CollectingCallback*>(state);
+        self->elements.push_back(element);
+        self->callback(element, self->arg);
     }
-    return nullptr;
+};
+
+/** Decode a sketch into output, going through the decode cache if it is enabled. */
+ssize_t DecodeCached(const Sketch* s, size_t max_elements, uint64_t* output, bool escalate)
+{
+    DecodeCache& cache = GetDecodeCache();
+    if (!cache.Enabled()) return s->Decode(max_elements, output, escalate);
+    DecodeCache::Key key = cache.MakeKey(s);
+    int ret;
+    std::vector<uint64_t> elements;
+    if (cache.Lookup(key, max_elements, ret, elements)) {
+        std::copy(elements.begin(), elements.end(), output);
+        return ret;
+    }
+    ret = s->Decode(max_elements, output, escalate);
+    cache.Insert(std::move(key), max_elements, ret, output);
+    return ret;
 }
 
 }
 
+uint64_t RandomSeed()
+{
+    thread_local SeedGenerator generator;
+    return generator.Next();
+}
+
 extern "C" {
 
 int minisketch_bits_supported(uint32_t bits) {
@@ -349,22 +502,210 @@ int minisketch_bits_supported(uint32_t bits) {
 #endif
 #ifdef ENABLE_FIELD_INT_64
     if (bits == 64) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_65
+    if (bits == 65) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_66
+    if (bits == 66) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_67
+    if (bits == 67) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_68
+    if (bits == 68) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_69
+    if (bits == 69) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_70
+    if (bits == 70) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_71
+    if (bits == 71) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_72
+    if (bits == 72) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_73
+    if (bits == 73) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_74
+    if (bits == 74) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_75
+    if (bits == 75) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_76
+    if (bits == 76) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_77
+    if (bits == 77) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_78
+    if (bits == 78) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_79
+    if (bits == 79) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_80
+    if (bits == 80) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_81
+    if (bits == 81) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_82
+    if (bits == 82) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_83
+    if (bits == 83) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_84
+    if (bits == 84) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_85
+    if (bits == 85) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_86
+    if (bits == 86) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_87
+    if (bits == 87) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_88
+    if (bits == 88) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_89
+    if (bits == 89) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_90
+    if (bits == 90) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_91
+    if (bits == 91) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_92
+    if (bits == 92) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_93
+    if (bits == 93) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_94
+    if (bits == 94) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_95
+    if (bits == 95) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_96
+    if (bits == 96) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_97
+    if (bits == 97) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_98
+    if (bits == 98) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_99
+    if (bits == 99) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_100
+    if (bits == 100) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_101
+    if (bits == 101) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_102
+    if (bits == 102) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_103
+    if (bits == 103) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_104
+    if (bits == 104) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_105
+    if (bits == 105) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_106
+    if (bits == 106) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_107
+    if (bits == 107) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_108
+    if (bits == 108) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_109
+    if (bits == 109) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_110
+    if (bits == 110) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_111
+    if (bits == 111) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_112
+    if (bits == 112) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_113
+    if (bits == 113) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_114
+    if (bits == 114) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_115
+    if (bits == 115) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_116
+    if (bits == 116) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_117
+    if (bits == 117) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_118
+    if (bits == 118) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_119
+    if (bits == 119) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_120
+    if (bits == 120) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_121
+    if (bits == 121) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_122
+    if (bits == 122) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_123
+    if (bits == 123) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_124
+    if (bits == 124) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_125
+    if (bits == 125) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_126
+    if (bits == 126) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_127
+    if (bits == 127) return true;
+#endif
+#ifdef ENABLE_FIELD_INT_128
+    if (bits == 128) return true;
 #endif
     return false;
 }
 
 uint32_t minisketch_implementation_max() {
-    uint32_t ret = 0;
-#ifdef HAVE_CLMUL
-    ret += 2;
-#endif
-    return ret;
+    return uint32_t(FieldImpl::COUNT) - 1;
 }
 
 int minisketch_implementation_supported(uint32_t bits, uint32_t implementation) {
-    if (!minisketch_bits_supported(bits) || implementation > minisketch_implementation_max()) {
-        return 0;
-    }
+    if (!minisketch_bits_supported(bits)) return 0;
+    if (implementation == MINISKETCH_IMPLEMENTATION_AUTO) return 1;
+    if (implementation > minisketch_implementation_max()) return 0;
     try {
         Sketch* sketch = Construct(bits, implementation);
         if (sketch) {
@@ -377,7 +718,8 @@ int minisketch_implementation_supported(uint32_t bits, uint32_t implementation)
 
 minisketch* minisketch_create(uint32_t bits, uint32_t implementation, size_t capacity) {
     try {
-        Sketch* sketch = Construct(bits, implementation);
+        if (!minisketch_bits_supported(bits)) return nullptr;
+        Sketch* sketch = Construct(bits, ResolveImplementation(bits, implementation));
         if (sketch) {
             try {
                 sketch->Init(capacity);
@@ -455,6 +797,18 @@ void minisketch_add_uint64(minisketch* sketch, uint64_t element) {
     s->Add(element);
 }
 
+size_t minisketch_element_size(const minisketch* sketch) {
+    const Sketch* s = (const Sketch*)sketch;
+    s->Check();
+    return (s->Bits() + 7) / 8;
+}
+
+void minisketch_add_bytes(minisketch* sketch, const unsigned char* element) {
+    Sketch* s = (Sketch*)sketch;
+    s->Check();
+    s->AddBytes(element);
+}
+
 size_t minisketch_merge(minisketch* sketch, const minisketch* other_sketch) {
     Sketch* s1 = (Sketch*)sketch;
     const Sketch* s2 = (const Sketch*)other_sketch;
@@ -468,7 +822,46 @@ size_t minisketch_merge(minisketch* sketch, const minisketch* other_sketch) {
 ssize_t minisketch_decode(const minisketch* sketch, size_t max_elements, uint64_t* output) {
     const Sketch* s = (const Sketch*)sketch;
     s->Check();
-    return s->Decode(max_elements, output);
+    return DecodeCached(s, max_elements, output, false);
+}
+
+ssize_t minisketch_decode_flags(const minisketch* sketch, size_t max_elements, uint64_t* output, uint32_t flags) {
+    const Sketch* s = (const Sketch*)sketch;
+    s->Check();
+    ssize_t ret = DecodeCached(s, max_elements, output, flags & MINISKETCH_DECODE_ESCALATE);
+    if (ret > 0 && (flags & MINISKETCH_DECODE_SORTED)) SortElements(output, ret, std::min(s->Bits(), 64));
+    return ret;
+}
+
+ssize_t minisketch_decode_callback(const minisketch* sketch, size_t max_elements, void (*callback)(uint64_t element, void* arg), void* arg) {
+    const Sketch* s = (const Sketch*)sketch;
+    s->Check();
+    DecodeCache& cache = GetDecodeCache();
+    if (!cache.Enabled()) return s->DecodeCallback(max_elements, callback, arg);
+    DecodeCache::Key key = cache.MakeKey(s);
+    int ret;
+    CollectingCallback state{callback, arg, {}};
+    if (cache.Lookup(key, max_elements, ret, state.elements)) {
+        for (uint64_t element : state.elements) callback(element, arg);
+        return ret;
+    }
+    ret = s->DecodeCallback(max_elements, CollectingCallback::Call, &state);
+    cache.Insert(std::move(key), max_elements, ret, state.elements.data());
+    return ret;
+}
+
+ssize_t minisketch_decode_bytes(const minisketch* sketch, size_t max_elements, unsigned char* output) {
+    const Sketch* s = (const Sketch*)sketch;
+    s->Check();
+    return s->DecodeBytes(max_elements, output);
+}
+
+void minisketch_decode_cache_configure(size_t max_entries) {
+    GetDecodeCache().Configure(max_entries);
+}
+
+void minisketch_decode_cache_stats(uint64_t* hits, uint64_t* misses) {
+    GetDecodeCache().Stats(*hits, *misses);
 }
 
 void minisketch_set_seed(minisketch* sketch, uint64_t seed) {
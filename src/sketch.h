@@ -10,6 +10,12 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+/** Get a random 64-bit value, for randomizing algorithm choices (see Sketch::SetSeed).
+ *
+ * This draws from a per-thread cryptographically secure generator, so it is cheap to call.
+ */
+uint64_t RandomSeed();
+
 /** Abstract class for internal representation of a minisketch object. */
 class Sketch
 {
@@ -31,12 +37,15 @@ public:
 
     virtual void Init(int syndromes) = 0;
     virtual void Add(uint64_t element) = 0;
+    virtual void AddBytes(const unsigned char* element) = 0;
     virtual void Serialize(unsigned char*) const = 0;
     virtual void Deserialize(const unsigned char*) = 0;
     virtual size_t Merge(const Sketch* other_sketch) = 0;
     virtual void SetSeed(uint64_t seed) = 0;
 
-    virtual int Decode(int max_count, uint64_t* roots) const = 0;
+    virtual int Decode(int max_count, uint64_t* roots, bool escalate) const = 0;
+    virtual int DecodeCallback(int max_count, void (*callback)(uint64_t, void*), void* arg) const = 0;
+    virtual int DecodeBytes(int max_count, unsigned char* roots) const = 0;
 };
 
 #endif
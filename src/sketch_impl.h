@@ -7,7 +7,9 @@
 #ifndef _MINISKETCH_SKETCH_IMPL_H_
 #define _MINISKETCH_SKETCH_IMPL_H_
 
-#include <random>
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 #include "util.h"
 #include "sketch.h"
@@ -23,12 +25,7 @@ void PolyMod(const std::vector<typename F::Elem>& mod, std::vector<typename F::E
     while (val.size() >= modsize) {
         auto term = val.back();
         val.pop_back();
-        if (term != 0) {
-            typename F::Multiplier mul(field, term);
-            for (size_t x = 0; x < mod.size() - 1; ++x) {
-                val[val.size() - modsize + 1 + x] ^= mul(mod[x]);
-            }
-        }
+        if (term != 0) field.AxpyVec(term, mod.data(), val.data() + val.size() - modsize + 1, modsize - 1);
     }
     while (val.size() > 0 && val.back() == 0) val.pop_back();
 }
@@ -48,12 +45,7 @@ void DivMod(const std::vector<typename F::Elem>& mod, std::vector<typename F::El
         auto term = val.back();
         div[val.size() - modsize] = term;
         val.pop_back();
-        if (term != 0) {
-            typename F::Multiplier mul(field, term);
-            for (size_t x = 0; x < mod.size() - 1; ++x) {
-                val[val.size() - modsize + 1 + x] ^= mul(mod[x]);
-            }
-        }
+        if (term != 0) field.AxpyVec(term, mod.data(), val.data() + val.size() - modsize + 1, modsize - 1);
     }
 }
 
@@ -63,11 +55,8 @@ typename F::Elem MakeMonic(std::vector<typename F::Elem>& a, const F& field) {
     CHECK_SAFE(a.back() != 0);
     if (a.back() == 1) return 0;
     auto inv = field.Inv(a.back());
-    typename F::Multiplier mul(field, inv);
     a.back() = 1;
-    for (size_t i = 0; i < a.size() - 1; ++i) {
-        a[i] = mul(a[i]);
-    }
+    field.MulVec(inv, a.data(), a.data(), a.size() - 1);
     return inv;
 }
 
@@ -119,13 +108,17 @@ void TraceMod(const std::vector<typename F::Elem>& mod, std::vector<typename F::
  * than `pos` are used as scratch space.
  *
  * `stack[pos]` is assumed to be square-free polynomial. If `fully_factorizable` is true, it is also assumed to have no irreducible
- * factors of degree higher than 1.
+ * factors of degree higher than 1. If `check_first` is true, the test for that is performed before any root is output, so that
+ * no roots are passed to `roots` when the polynomial turns out not to be fully factorizable.
 
+ * Quadratic factors that are known to have roots are not solved immediately, but appended to
+ * `quadratics` as (constant, linear) coefficient pairs, to be solved together by SolveQuadratics.
+ *
  * This implements the Berlekamp trace algorithm, plus an efficient test to fail fast in
  * case the polynomial cannot be fully factored.
  */
-template<typename F>
-bool RecFindRoots(std::vector<std::vector<typename F::Elem>>& stack, size_t pos, std::vector<typename F::Elem>& roots, bool fully_factorizable, int depth, typename F::Elem randv, const F& field) {
+template<typename F, typename R>
+bool RecFindRoots(std::vector<std::vector<typename F::Elem>>& stack, size_t pos, R& roots, std::vector<typename F::Elem>& quadratics, bool fully_factorizable, bool check_first, int depth, typename F::Elem randv, const F& field) {
     auto& ppoly = stack[pos];
     // We assert ppoly.size() > 1 (instead of just ppoly.size() > 0) to additionally exclude
     // constants polynomials because
@@ -140,6 +133,12 @@ bool RecFindRoots(std::vector<std::vector<typename F::Elem>>& stack, size_t pos,
     /* 2nd degree input: use direct quadratic solver. */
     if (ppoly.size() == 3) {
         CHECK_RETURN(ppoly[1] != 0, false); // Equations of the form (x^2 + a) have two identical solutions; contradicts square-free assumption. */
+        if (fully_factorizable) {
+            // Roots are known to exist; defer solving so all such quadratics share one inversion.
+            quadratics.push_back(ppoly[0]);
+            quadratics.push_back(ppoly[1]);
+            return true;
+        }
         auto input = field.Mul(ppoly[0], field.Sqr(field.Inv(ppoly[1])));
         auto root = field.Qrt(input);
         if ((field.Sqr(root) ^ root) != input) {
@@ -166,7 +165,7 @@ bool RecFindRoots(std::vector<std::vector<typename F::Elem>>& stack, size_t pos,
         // and put the result in `trace`.
         TraceMod(poly, trace, randv, field);
 
-        if (iter >= 1 && !fully_factorizable) {
+        if ((iter >= 1 || check_first) && !fully_factorizable) {
             // If the polynomial cannot be factorized completely (it has an
             // irreducible factor of degree higher than 1), we want to avoid
             // the case where this is only detected after trying all BITS
@@ -241,16 +240,39 @@ bool RecFindRoots(std::vector<std::vector<typename F::Elem>>& stack, size_t pos,
     std::swap(poly, trace);
     // Now the stack is [... (trace) tmp ...]. First we factor tmp (at pos = pos+1), and then
     // we factor trace (at pos = pos).
-    if (!RecFindRoots(stack, pos + 1, roots, fully_factorizable, depth, randv, field)) return false;
+    if (!RecFindRoots(stack, pos + 1, roots, quadratics, fully_factorizable, false, depth, randv, field)) return false;
     // The stack position pos contains trace, the polynomial with all of poly's roots which (after
     // multiplication with randv) have trace 0. This is never the case for irreducible factors
     // (which always end up in tmp), so we can set fully_factorizable to true when recursing.
-    bool ret = RecFindRoots(stack, pos, roots, true, depth, randv, field);
+    bool ret = RecFindRoots(stack, pos, roots, quadratics, true, false, depth, randv, field);
     // Because of the above, recursion can never fail here.
     CHECK_SAFE(ret);
     return ret;
 }
 
+/** Output the roots of the quadratics x^2 + b*x + c collected by RecFindRoots, as (c, b) pairs.
+ *
+ * Substituting x = b*y gives y^2 + y = c/b^2, so every quadratic needs the inverse of its b;
+ * these are computed with a single batched inversion. Returns false if any has no roots.
+ */
+template<typename F, typename R>
+bool SolveQuadratics(const std::vector<typename F::Elem>& quadratics, R& roots, const F& field) {
+    size_t count = quadratics.size() / 2;
+    if (count == 0) return true;
+    std::vector<typename F::Elem> invs(count), tmp(count);
+    for (size_t i = 0; i < count; ++i) invs[i] = quadratics[2 * i + 1];
+    field.InvVec(invs.data(), tmp.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        auto input = field.Mul(quadratics[2 * i], field.Sqr(invs[i]));
+        auto root = field.Qrt(input);
+        CHECK_RETURN((field.Sqr(root) ^ root) == input, false);
+        auto sol = field.Mul(root, quadratics[2 * i + 1]);
+        roots.push_back(sol);
+        roots.push_back(sol ^ quadratics[2 * i + 1]);
+    }
+    return true;
+}
+
 /** Returns the roots of a fully factorizable polynomial
  *
  * This function assumes that the input polynomial is square-free
@@ -267,60 +289,409 @@ std::vector<typename F::Elem> FindRoots(const std::vector<typename F::Elem>& pol
     if (poly.size() == 1) return roots; // No roots when the polynomial is a constant.
     roots.reserve(poly.size() - 1);
     std::vector<std::vector<typename F::Elem>> stack = {poly};
+    std::vector<typename F::Elem> quadratics;
 
     // Invoke the recursive factorization algorithm.
-    if (!RecFindRoots(stack, 0, roots, false, 0, basis, field)) {
+    if (!RecFindRoots(stack, 0, roots, quadratics, false, false, 0, basis, field)) {
         // Not fully factorizable.
         return {};
     }
+    CHECK_RETURN(SolveQuadratics(quadratics, roots, field), {});
     CHECK_RETURN(poly.size() - 1 == roots.size(), {});
     return roots;
 }
 
+/** Output for FindRootsStreaming that passes every root to a callback as a uint64_t. */
 template<typename F>
-std::vector<typename F::Elem> BerlekampMassey(const std::vector<typename F::Elem>& syndromes, size_t max_degree, const F& field) {
-    std::vector<typename F::Multiplier> table;
-    std::vector<typename F::Elem> current, prev, tmp;
-    current.reserve(syndromes.size() / 2 + 1);
-    prev.reserve(syndromes.size() / 2 + 1);
-    tmp.reserve(syndromes.size() / 2 + 1);
-    current.resize(1);
-    current[0] = 1;
-    prev.resize(1);
-    prev[0] = 1;
-    typename F::Elem b = 1, b_inv = 1;
-    bool b_have_inv = true;
-    table.reserve(syndromes.size());
-
-    for (size_t n = 0; n != syndromes.size(); ++n) {
-        table.emplace_back(field, syndromes[n]);
-        auto discrepancy = syndromes[n];
-        for (size_t i = 1; i < current.size(); ++i) discrepancy ^= table[n - i](current[i]);
-        if (discrepancy != 0) {
-            int x = n + 1 - (current.size() - 1) - (prev.size() - 1);
-            if (!b_have_inv) {
-                b_inv = field.Inv(b);
-                b_have_inv = true;
-            }
-            bool swap = 2 * (current.size() - 1) <= n;
-            if (swap) {
-                if (prev.size() + x - 1 > max_degree) return {}; // We'd exceed maximum degree
-                tmp = current;
-                current.resize(prev.size() + x);
-            }
-            typename F::Multiplier mul(field, field.Mul(discrepancy, b_inv));
-            for (size_t i = 0; i < prev.size(); ++i) current[i + x] ^= mul(prev[i]);
-            if (swap) {
-                std::swap(prev, tmp);
-                b = discrepancy;
-                b_have_inv = false;
+class RootCallback
+{
+    const F& m_field;
+    void (*m_callback)(uint64_t, void*);
+    void* m_arg;
+    size_t m_count = 0;
+
+public:
+    RootCallback(const F& field, void (*callback)(uint64_t, void*), void* arg) : m_field(field), m_callback(callback), m_arg(arg) {}
+
+    void push_back(typename F::Elem root)
+    {
+        m_callback(m_field.ToUint64(root), m_arg);
+        ++m_count;
+    }
+
+    size_t size() const { return m_count; }
+};
+
+/** Like FindRoots, but roots are passed to out.push_back() as soon as they are found.
+ *
+ * Returns false if the polynomial is not fully factorizable. In that case no roots
+ * have been output.
+ */
+template<typename F, typename R>
+bool FindRootsStreaming(const std::vector<typename F::Elem>& poly, typename F::Elem basis, R& out, const F& field) {
+    CHECK_RETURN(poly.size() != 0, false);
+    CHECK_RETURN(basis != 0, false);
+    if (poly.size() == 1) return true; // No roots when the polynomial is a constant.
+    std::vector<std::vector<typename F::Elem>> stack = {poly};
+    std::vector<typename F::Elem> quadratics;
+
+    // Invoke the recursive factorization algorithm, testing for full factorizability
+    // before any root is found.
+    if (!RecFindRoots(stack, 0, out, quadratics, false, true, 0, basis, field)) {
+        // Not fully factorizable.
+        return false;
+    }
+    CHECK_RETURN(SolveQuadratics(quadratics, out, field), false);
+    CHECK_RETURN(poly.size() - 1 == out.size(), false);
+    return true;
+}
+
+/** State of the Berlekamp-Massey algorithm, permitting syndromes to be processed incrementally. */
+template<typename F>
+class BerlekampMasseyState
+{
+    const F& m_field;
+    std::vector<typename F::Multiplier> m_table;
+    std::vector<typename F::Elem> m_current, m_prev, m_tmp;
+    typename F::Elem m_b = 1, m_b_inv = 1;
+    bool m_b_have_inv = true;
+
+public:
+    BerlekampMasseyState(size_t syndromes, const F& field) : m_field(field)
+    {
+        m_current.reserve(syndromes / 2 + 1);
+        m_prev.reserve(syndromes / 2 + 1);
+        m_tmp.reserve(syndromes / 2 + 1);
+        m_current.resize(1);
+        m_current[0] = 1;
+        m_prev.resize(1);
+        m_prev[0] = 1;
+        m_table.reserve(syndromes);
+    }
+
+    /** Process syndromes up to (but excluding) position end. Returns false if the degree would exceed max_degree. */
+    bool Process(const std::vector<typename F::Elem>& syndromes, size_t end, size_t max_degree)
+    {
+        auto& table = m_table;
+        auto& current = m_current;
+        auto& prev = m_prev;
+        for (size_t n = table.size(); n != end; ++n) {
+            table.emplace_back(m_field, syndromes[n]);
+            auto discrepancy = syndromes[n];
+            for (size_t i = 1; i < current.size(); ++i) discrepancy ^= table[n - i](current[i]);
+            if (discrepancy != 0) {
+                int x = n + 1 - (current.size() - 1) - (prev.size() - 1);
+                if (!m_b_have_inv) {
+                    m_b_inv = m_field.Inv(m_b);
+                    m_b_have_inv = true;
+                }
+                bool swap = 2 * (current.size() - 1) <= n;
+                if (swap) {
+                    if (prev.size() + x - 1 > max_degree) return false; // We'd exceed maximum degree
+                    m_tmp = current;
+                    current.resize(prev.size() + x);
+                }
+                m_field.AxpyVec(m_field.Mul(discrepancy, m_b_inv), prev.data(), current.data() + x, prev.size());
+                if (swap) {
+                    std::swap(prev, m_tmp);
+                    m_b = discrepancy;
+                    m_b_have_inv = false;
+                }
             }
         }
+        return true;
     }
+
+    /** Check whether the current polynomial also generates the syndromes from position start onwards.
+     *
+     * If so, processing those syndromes would not change the state. Unlike Process(), this does not
+     * need any per-syndrome precomputation.
+     */
+    bool Verify(const std::vector<typename F::Elem>& syndromes, size_t start) const
+    {
+        std::vector<typename F::Multiplier> coefs;
+        coefs.reserve(m_current.size() - 1);
+        for (size_t i = 1; i < m_current.size(); ++i) coefs.emplace_back(m_field, m_current[i]);
+        for (size_t n = start; n < syndromes.size(); ++n) {
+            auto discrepancy = syndromes[n];
+            for (size_t i = 1; i < m_current.size(); ++i) discrepancy ^= coefs[i - 1](syndromes[n - i]);
+            if (discrepancy != 0) return false;
+        }
+        return true;
+    }
+
+    /** Get the current connection polynomial. */
+    const std::vector<typename F::Elem>& Current() const { return m_current; }
+};
+
+template<typename F>
+std::vector<typename F::Elem> BerlekampMassey(const std::vector<typename F::Elem>& syndromes, size_t max_degree, const F& field) {
+    BerlekampMasseyState<F> state(syndromes.size(), field);
+    if (!state.Process(syndromes, syndromes.size(), max_degree)) return {};
+    const auto& current = state.Current();
     CHECK_RETURN(current.size() && current.back() != 0, {});
     return current;
 }
 
+/** Like BerlekampMassey, but first try increasingly long prefixes of the syndromes.
+ *
+ * After processing a prefix, the resulting polynomial is checked against the remaining
+ * syndromes. If it generates all of them, it is the result BerlekampMassey would return,
+ * and no further processing is needed. Otherwise processing resumes with a prefix twice
+ * as long. As a result the cost scales with the degree of the result rather than with
+ * the number of syndromes.
+ *
+ * A connection polynomial of degree at most max_degree is uniquely determined by the
+ * first 2*max_degree syndromes, so if the check fails after processing that many, there
+ * is no solution.
+ */
+template<typename F>
+std::vector<typename F::Elem> EscalatingBerlekampMassey(const std::vector<typename F::Elem>& syndromes, size_t max_degree, const F& field) {
+    BerlekampMasseyState<F> state(syndromes.size(), field);
+    size_t limit = std::min(syndromes.size(), 2 * max_degree);
+    size_t end = std::min<size_t>(limit, 8);
+    while (true) {
+        if (!state.Process(syndromes, end, max_degree)) return {};
+        if (state.Verify(syndromes, end)) break;
+        if (end == limit) return {};
+        end = std::min(limit, end * 2);
+    }
+    const auto& current = state.Current();
+    CHECK_RETURN(current.size() && current.back() != 0, {});
+    return current;
+}
+
+/** Below this many coefficients in the shorter operand, polynomials are multiplied directly. */
+static constexpr size_t KARATSUBA_THRESHOLD = 32;
+
+/** Add the product of the polynomials a (with na coefficients) and b (with nb coefficients) to out.
+ *
+ * out must have room for na + nb - 1 coefficients. Large inputs are multiplied using Karatsuba's
+ * method, which needs O(n^1.58) field multiplications.
+ */
+template<typename F>
+void PolyMulAdd(const typename F::Elem* a, size_t na, const typename F::Elem* b, size_t nb, typename F::Elem* out, const F& field) {
+    if (na < nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    if (nb == 0) return;
+    if (nb < KARATSUBA_THRESHOLD) {
+        for (size_t j = 0; j < nb; ++j) {
+            if (b[j] != 0) field.AxpyVec(b[j], a, out + j, na);
+        }
+        return;
+    }
+    size_t half = (na + 1) / 2;
+    if (nb <= half) {
+        // Unbalanced sizes; multiply b with nb-sized pieces of a.
+        for (size_t pos = 0; pos < na; pos += nb) {
+            PolyMulAdd(a + pos, std::min(nb, na - pos), b, nb, out + pos, field);
+        }
+        return;
+    }
+    // Split a = a0 + x^half*a1 and b = b0 + x^half*b1. Then
+    // a*b = a0*b0 + x^half*((a0+a1)*(b0+b1) - a0*b0 - a1*b1) + x^(2*half)*a1*b1.
+    std::vector<typename F::Elem> suma(half), sumb(half), low(2 * half - 1), mid(2 * half - 1), high(na + nb - 2 * half - 1);
+    for (size_t i = 0; i < half; ++i) {
+        suma[i] = a[i] ^ (i + half < na ? a[i + half] : 0);
+        sumb[i] = b[i] ^ (i + half < nb ? b[i + half] : 0);
+    }
+    PolyMulAdd(a, half, b, half, low.data(), field);
+    PolyMulAdd(a + half, na - half, b + half, nb - half, high.data(), field);
+    PolyMulAdd(suma.data(), half, sumb.data(), half, mid.data(), field);
+    for (size_t i = 0; i < low.size(); ++i) {
+        out[i] ^= low[i];
+        mid[i] ^= low[i];
+    }
+    for (size_t i = 0; i < high.size(); ++i) {
+        out[i + 2 * half] ^= high[i];
+        mid[i] ^= high[i];
+    }
+    for (size_t i = 0; i < mid.size(); ++i) out[i + half] ^= mid[i];
+}
+
+/** Compute the product of two polynomials. */
+template<typename F>
+std::vector<typename F::Elem> PolyMul(const std::vector<typename F::Elem>& a, const std::vector<typename F::Elem>& b, const F& field) {
+    if (a.empty() || b.empty()) return {};
+    std::vector<typename F::Elem> ret(a.size() + b.size() - 1);
+    PolyMulAdd(a.data(), a.size(), b.data(), b.size(), ret.data(), field);
+    return ret;
+}
+
+/** Compute the quotient and remainder of the division of val by a nonzero, not necessarily monic, mod.
+ *  The quotient is put in div, the remainder in val. */
+template<typename F>
+void DivModGeneral(const std::vector<typename F::Elem>& mod, std::vector<typename F::Elem>& val, std::vector<typename F::Elem>& div, const F& field) {
+    CHECK_SAFE(mod.size() > 0 && mod.back() != 0);
+    div.clear();
+    if (val.size() < mod.size()) return;
+    div.resize(val.size() - mod.size() + 1);
+    typename F::Multiplier inv(field, field.Inv(mod.back()));
+    while (val.size() >= mod.size()) {
+        auto term = inv(val.back());
+        div[val.size() - mod.size()] = term;
+        val.pop_back();
+        if (term != 0) field.AxpyVec(term, mod.data(), val.data() + val.size() - mod.size() + 1, mod.size() - 1);
+    }
+    while (val.size() > 0 && val.back() == 0) val.pop_back();
+}
+
+/** A 2x2 matrix of polynomials, used to represent a sequence of steps of Euclid's algorithm. */
+template<typename F>
+struct PolyMatrix
+{
+    std::vector<typename F::Elem> m[2][2];
+
+    /** Set this matrix to the identity. */
+    void SetIdentity()
+    {
+        m[0][0] = {1};
+        m[0][1].clear();
+        m[1][0].clear();
+        m[1][1] = {1};
+    }
+
+    /** Apply one step of Euclid's algorithm with quotient q, i.e. multiply this matrix by [[0, 1], [1, q]] from the left. */
+    void Step(const std::vector<typename F::Elem>& q, const F& field)
+    {
+        for (int col = 0; col < 2; ++col) {
+            auto prod = PolyMul(q, m[1][col], field);
+            auto& row0 = m[0][col];
+            if (prod.size() < row0.size()) prod.resize(row0.size());
+            for (size_t i = 0; i < row0.size(); ++i) prod[i] ^= row0[i];
+            while (prod.size() > 0 && prod.back() == 0) prod.pop_back();
+            row0 = std::move(m[1][col]);
+            m[1][col] = std::move(prod);
+        }
+    }
+};
+
+/** Compute a*x + b*y. */
+template<typename F>
+std::vector<typename F::Elem> PolyMulAdd2(const std::vector<typename F::Elem>& a, const std::vector<typename F::Elem>& x, const std::vector<typename F::Elem>& b, const std::vector<typename F::Elem>& y, const F& field) {
+    size_t size = std::max(a.empty() || x.empty() ? 0 : a.size() + x.size() - 1, b.empty() || y.empty() ? 0 : b.size() + y.size() - 1);
+    std::vector<typename F::Elem> ret(size);
+    PolyMulAdd(a.data(), a.size(), x.data(), x.size(), ret.data(), field);
+    PolyMulAdd(b.data(), b.size(), y.data(), y.size(), ret.data(), field);
+    while (ret.size() > 0 && ret.back() == 0) ret.pop_back();
+    return ret;
+}
+
+/** Below this many degrees of reduction, HalfGCD runs Euclid's algorithm directly. */
+static constexpr long HALF_GCD_THRESHOLD = 32;
+
+/** Compute a matrix mat of Euclid steps that reduces (u, v), with deg(u) > deg(v), to (u', v') = mat * (u, v)
+ *  with deg(v') <= deg(u) - red < deg(u').
+ *
+ * This is the half-GCD algorithm, which only looks at the top 2*red coefficients of u and v, and
+ * splits the work into two recursive calls of half that size, to achieve O(M(red) log(red))
+ * complexity where M(n) is the cost of multiplying two polynomials of degree n.
+ */
+template<typename F>
+void HalfGCD(PolyMatrix<F>& mat, const std::vector<typename F::Elem>& u, const std::vector<typename F::Elem>& v, long red, const F& field) {
+    long degu = long(u.size()) - 1, degv = long(v.size()) - 1;
+    mat.SetIdentity();
+    if (degv < 0 || degv <= degu - red) return;
+    // Only the top 2*red coefficients affect the quotients; drop the others.
+    size_t shift = std::max<long>(0, degu - 2 * red + 2);
+    std::vector<typename F::Elem> u1(u.begin() + shift, u.end()), v1(v.begin() + std::min(shift, v.size()), v.end()), q;
+    if (red < HALF_GCD_THRESHOLD) {
+        long goal = long(u1.size()) - 1 - red;
+        while (long(v1.size()) - 1 > goal) {
+            DivModGeneral(v1, u1, q, field);
+            std::swap(u1, v1);
+            mat.Step(q, field);
+        }
+        return;
+    }
+    // Reduce by about red/2 degrees using the top coefficients only.
+    long red1 = (red + 1) / 2;
+    HalfGCD(mat, u1, v1, red1, field);
+    auto u2 = PolyMulAdd2(mat.m[0][0], u1, mat.m[0][1], v1, field);
+    auto v2 = PolyMulAdd2(mat.m[1][0], u1, mat.m[1][1], v1, field);
+    // Then perform one step directly, and recurse for the remaining reduction.
+    long red2 = long(v2.size()) - 1 - degu + long(shift) + red;
+    if (v2.empty() || red2 <= 0) return;
+    DivModGeneral(v2, u2, q, field);
+    std::swap(u2, v2);
+    mat.Step(q, field);
+    PolyMatrix<F> mat2;
+    HalfGCD(mat2, u2, v2, red2, field);
+    PolyMatrix<F> prod;
+    for (int row = 0; row < 2; ++row) {
+        for (int col = 0; col < 2; ++col) {
+            prod.m[row][col] = PolyMulAdd2(mat2.m[row][0], mat.m[0][col], mat2.m[row][1], mat.m[1][col], field);
+        }
+    }
+    mat = std::move(prod);
+}
+
+/** Compute the same result as BerlekampMassey(syndromes, max_degree), by solving the key equation using HalfGCD.
+ *
+ * This needs O(M(n) log(n)) rather than O(n^2) field operations. It finds the connection polynomial
+ * whenever it has degree at most syndromes.size() / 2. Returns false if there is no such polynomial,
+ * in which case BerlekampMassey may still find one of higher degree if max_degree permits.
+ */
+template<typename F>
+bool HalfGCDBerlekampMassey(const std::vector<typename F::Elem>& syndromes, size_t max_degree, std::vector<typename F::Elem>& result, const F& field) {
+    result.clear();
+    size_t half = syndromes.size() / 2;
+    // Run Euclid's algorithm on x^(2*half) and the reversed syndrome sequence, until the degree of
+    // the remainder drops below half. The reversed connection polynomial is then the cofactor of
+    // the reversed syndromes.
+    std::vector<typename F::Elem> rev(syndromes.rbegin() + (syndromes.size() - 2 * half), syndromes.rend()), xpow(2 * half + 1);
+    while (rev.size() > 0 && rev.back() == 0) rev.pop_back();
+    xpow.back() = 1;
+    PolyMatrix<F> mat;
+    HalfGCD(mat, xpow, rev, half + 1, field);
+    auto& poly = mat.m[1][1];
+    CHECK_RETURN(poly.size() > 0, false);
+    if (poly[0] == 0) return false;
+    MakeMonic(poly, field);
+    std::reverse(poly.begin(), poly.end());
+    // The result is only a valid connection polynomial if it generates all syndromes, i.e. if
+    // the product of it with the syndrome series has no terms of degree deg(poly) up to the
+    // number of syndromes.
+    auto prod = PolyMul(poly, syndromes, field);
+    for (size_t i = poly.size() - 1; i < syndromes.size(); ++i) {
+        if (prod[i] != 0) return false;
+    }
+    if (poly.size() - 1 <= max_degree) result = std::move(poly);
+    return true;
+}
+
+/** Whether HalfGCDBerlekampMassey is expected to be faster than BerlekampMassey for a given number of syndromes.
+ *
+ * BerlekampMassey is quadratic, but has a small constant factor as long as its per-syndrome Multiplier
+ * objects fit in cache. Measured crossovers are around 32768 syndromes for fields with cheap Multipliers,
+ * and around 8 MiB of Multipliers for table-based ones. Verify builds switch much earlier, to get both
+ * algorithms compared in tests.
+ */
+template<typename F>
+bool UseHalfGCD(size_t syndromes) {
+#ifdef MINISKETCH_VERIFY
+    return syndromes >= 64;
+#else
+    return syndromes >= 32768 || syndromes * sizeof(typename F::Multiplier) >= (size_t{1} << 23);
+#endif
+}
+
+/** Compute the connection polynomial like BerlekampMassey does, picking the fastest algorithm. */
+template<typename F>
+std::vector<typename F::Elem> FastBerlekampMassey(const std::vector<typename F::Elem>& syndromes, size_t max_degree, const F& field) {
+    if (!UseHalfGCD<F>(syndromes.size())) return BerlekampMassey(syndromes, max_degree, field);
+    std::vector<typename F::Elem> ret;
+    if (!HalfGCDBerlekampMassey(syndromes, max_degree, ret, field)) {
+        // Only a connection polynomial of degree above syndromes.size() / 2 could exist.
+        if (max_degree > syndromes.size() / 2) return BerlekampMassey(syndromes, max_degree, field);
+        return {};
+    }
+    CHECK_SAFE(ret == BerlekampMassey(syndromes, max_degree, field));
+    return ret;
+}
+
 template<typename F>
 std::vector<typename F::Elem> ReconstructAllSyndromes(const std::vector<typename F::Elem>& odd_syndromes, const F& field) {
     std::vector<typename F::Elem> all_syndromes;
@@ -336,10 +707,25 @@ template<typename F>
 void AddToOddSyndromes(std::vector<typename F::Elem>& osyndromes, typename F::Elem data, const F& field) {
     auto sqr = field.Sqr(data);
     typename F::Multiplier mul(field, sqr);
-    for (auto& osyndrome : osyndromes) {
-        osyndrome ^= data;
+    static constexpr size_t BLOCK = 16;
+    if (osyndromes.size() < 8 * BLOCK) {
+        for (auto& osyndrome : osyndromes) {
+            osyndrome ^= data;
+            data = mul(data);
+        }
+        return;
+    }
+    // Compute the first BLOCK odd powers of data one by one, and then all further ones
+    // with a single vector multiplication by data^(2*BLOCK), each block from the previous one.
+    std::vector<typename F::Elem> powers(osyndromes.size());
+    for (size_t i = 0; i < BLOCK; ++i) {
+        powers[i] = data;
         data = mul(data);
     }
+    auto step = sqr;
+    for (size_t i = 1; i < BLOCK; i <<= 1) step = field.Sqr(step);
+    field.MulVec(step, powers.data(), powers.data() + BLOCK, powers.size() - BLOCK);
+    for (size_t i = 0; i < osyndromes.size(); ++i) osyndromes[i] ^= powers[i];
 }
 
 template<typename F>
@@ -360,9 +746,7 @@ class SketchImpl final : public Sketch
 public:
     template<typename... Args>
     SketchImpl(int implementation, int bits, const Args&... args) : Sketch(implementation, bits), m_field(args...) {
-        std::random_device rng;
-        std::uniform_int_distribution<uint64_t> dist;
-        m_basis = m_field.FromSeed(dist(rng));
+        m_basis = m_field.FromSeed(RandomSeed());
     }
 
     size_t Syndromes() const override { return m_syndromes.size(); }
@@ -374,6 +758,13 @@ public:
         AddToOddSyndromes(m_syndromes, elem, m_field);
     }
 
+    /** Add an element given as (Bits() + 7) / 8 little-endian bytes; bits beyond Bits() are ignored. */
+    void AddBytes(const unsigned char* ptr) override
+    {
+        BitReader reader(ptr);
+        AddToOddSyndromes(m_syndromes, m_field.Deserialize(reader), m_field);
+    }
+
     void Serialize(unsigned char* ptr) const override
     {
         BitWriter writer(ptr);
@@ -391,23 +782,67 @@ public:
         }
     }
 
-    int Decode(int max_count, uint64_t* out) const override
+    /** Compute the polynomial whose roots are the elements of this sketch, if it has at most max_count roots.
+     *  Returns an empty vector on failure. */
+    std::vector<typename F::Elem> ComputePoly(int max_count, bool escalate) const
     {
         auto all_syndromes = ReconstructAllSyndromes(m_syndromes, m_field);
-        auto poly = BerlekampMassey(all_syndromes, max_count, m_field);
+        auto poly = escalate ? EscalatingBerlekampMassey(all_syndromes, max_count, m_field) : FastBerlekampMassey(all_syndromes, max_count, m_field);
+        if ((int)poly.size() > 1 + max_count) return {};
+        std::reverse(poly.begin(), poly.end());
+        return poly;
+    }
+
+    int Decode(int max_count, uint64_t* out, bool escalate) const override
+    {
+        auto poly = ComputePoly(max_count, escalate);
         if (poly.size() == 0) return -1;
         if (poly.size() == 1) return 0;
-        if ((int)poly.size() > 1 + max_count) return -1;
-        std::reverse(poly.begin(), poly.end());
         auto roots = FindRoots(poly, m_basis, m_field);
         if (roots.size() == 0) return -1;
 
         for (const auto& root : roots) {
+            // In fields over 64 bits, fail if an element does not fit the output.
+            if (m_field.Bits() > 64 && m_field.FromUint64(m_field.ToUint64(root)) != root) return -1;
             *(out++) = m_field.ToUint64(root);
         }
         return roots.size();
     }
 
+    int DecodeCallback(int max_count, void (*callback)(uint64_t, void*), void* arg) const override
+    {
+        if (m_field.Bits() > 64) {
+            // Whether all elements fit in 64 bits is only known once they are all found.
+            int count = std::max(0, std::min<int>(max_count, m_syndromes.size()));
+            std::vector<uint64_t> roots(count);
+            int ret = Decode(count, roots.data(), false);
+            for (int i = 0; i < ret; ++i) callback(roots[i], arg);
+            return ret;
+        }
+        auto poly = ComputePoly(max_count, false);
+        if (poly.size() == 0) return -1;
+        RootCallback<F> out(m_field, callback, arg);
+        if (!FindRootsStreaming(poly, m_basis, out, m_field)) return -1;
+        return out.size();
+    }
+
+    int DecodeBytes(int max_count, unsigned char* out) const override
+    {
+        auto poly = ComputePoly(max_count, false);
+        if (poly.size() == 0) return -1;
+        if (poly.size() == 1) return 0;
+        auto roots = FindRoots(poly, m_basis, m_field);
+        if (roots.size() == 0) return -1;
+
+        for (const auto& root : roots) {
+            BitWriter writer(out);
+            m_field.Serialize(writer, root);
+            writer.Flush();
+            out += (m_field.Bits() + 7) / 8;
+        }
+        return roots.size();
+    }
+
     size_t Merge(const Sketch* other_sketch) override
     {
         // Sad cast. This is safe only because the caller code in minisketch.cpp checks
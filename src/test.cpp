@@ -85,6 +85,14 @@ void TestExhaustive(uint32_t bits, size_t capacity) {
             CHECK(elements_other == elements_0);
         }
 
+        // Verify that escalating decoding agrees.
+        for (size_t impl = 0; impl < sketches.size(); ++impl) {
+            elements_other.resize(64);
+            bool decodable_other = sketches[impl].Decode(elements_other, MINISKETCH_DECODE_ESCALATE | MINISKETCH_DECODE_SORTED);
+            CHECK(decodable_other == decodable_0);
+            if (decodable_0) CHECK(elements_other == elements_0);
+        }
+
         // If there are solutions:
         if (decodable_0) {
             if (!elements_0.empty()) {
@@ -210,7 +218,34 @@ void TestRandomized(uint32_t bits, size_t max_capacity, size_t iter) {
                     decode_temp.resize(decode_0.size() - 1);
                     decodable = sketch.Decode(decode_temp);
                     CHECK(!decodable);
+                    decodable = sketch.Decode(decode_temp, MINISKETCH_DECODE_ESCALATE);
+                    CHECK(!decodable);
                 }
+                // Escalating decoding should produce the same result.
+                decode_temp.resize(capacity);
+                decodable = sketch.Decode(decode_temp, MINISKETCH_DECODE_ESCALATE | MINISKETCH_DECODE_SORTED);
+                CHECK(decodable);
+                CHECK(decode_temp == decode_0);
+                // Sorted decoding should produce the elements in order.
+                decode_temp.resize(decode_0.size());
+                decodable = sketch.Decode(decode_temp, MINISKETCH_DECODE_SORTED);
+                CHECK(decodable);
+                CHECK(decode_temp == decode_0);
+                // Streaming decoding should report the same elements.
+                decode_temp.clear();
+                decodable = sketch.DecodeCallback(decode_0.size(), [&](uint64_t elem) { decode_temp.push_back(elem); });
+                CHECK(decodable);
+                std::sort(decode_temp.begin(), decode_temp.end());
+                CHECK(decode_temp == decode_0);
+            }
+        } else {
+            // Streaming decoding of an undecodable sketch should not report any elements.
+            for (auto& sketch : sketches) {
+                decode_temp.resize(capacity);
+                CHECK(!sketch.Decode(decode_temp, MINISKETCH_DECODE_ESCALATE));
+                bool called = false;
+                CHECK(!sketch.DecodeCallback(capacity, [&](uint64_t) { called = true; }));
+                CHECK(!called);
             }
         }
         // If the actual number of elements is not higher than the capacity, the
@@ -222,6 +257,129 @@ void TestRandomized(uint32_t bits, size_t max_capacity, size_t iter) {
     }
 }
 
+/** Test that the decode cache returns the same results as decoding, and counts hits and misses. */
+void TestDecodeCache(uint32_t bits, size_t capacity, size_t iter) {
+    auto sketches = CreateSketches(bits, capacity);
+    if (sketches.empty()) return;
+    std::random_device rnd;
+    std::uniform_int_distribution<uint64_t> dist;
+    Minisketch::ConfigureDecodeCache(4);
+    for (size_t i = 0; i < iter; ++i) {
+        for (auto& sketch : sketches) {
+            size_t num = dist(rnd) % (capacity + 2);
+            for (size_t j = 0; j < num; ++j) sketch.Add(dist(rnd));
+            std::vector<uint64_t> expected(capacity), expected_small(capacity / 2);
+            Minisketch::ConfigureDecodeCache(0);
+            bool decodable = sketch.Decode(expected);
+            bool decodable_small = sketch.Decode(expected_small);
+            Minisketch::ConfigureDecodeCache(4);
+            uint64_t hits, misses;
+            for (int rep = 0; rep < 2; ++rep) {
+                std::vector<uint64_t> result(capacity), result_small(capacity / 2), result_callback;
+                CHECK(sketch.Decode(result) == decodable);
+                CHECK(sketch.Decode(result_small) == decodable_small);
+                CHECK(sketch.DecodeCallback(capacity, [&](uint64_t element) { result_callback.push_back(element); }) == decodable);
+                if (decodable) {
+                    CHECK(result == expected);
+                    CHECK(result_callback == expected);
+                }
+                if (decodable_small) CHECK(result_small == expected_small);
+                Minisketch::DecodeCacheStats(hits, misses);
+                // Only the very first decode is a miss; the result for fewer elements is implied by it.
+                CHECK(misses == 1);
+                CHECK(hits == (rep ? 5U : 2U));
+            }
+            Minisketch::ConfigureDecodeCache(4);
+        }
+    }
+    Minisketch::ConfigureDecodeCache(0);
+}
+
+/** Test sketches of elements given as bytes, including elements over 64 bits. */
+void TestBytes(uint32_t bits, size_t capacity, size_t iter) {
+    std::random_device rnd;
+    std::uniform_int_distribution<uint64_t> dist;
+    const size_t size = (bits + 7) / 8;
+    for (size_t i = 0; i < iter; ++i) {
+        auto sketches = CreateSketches(bits, capacity);
+        if (sketches.empty()) return;
+        size_t count = dist(rnd) % (capacity + 1);
+        // Random distinct elements, all nonzero in their lowest byte.
+        std::vector<std::vector<unsigned char>> elements;
+        while (elements.size() < count) {
+            std::vector<unsigned char> element(size);
+            for (auto& byte : element) byte = dist(rnd);
+            element[0] |= 1;
+            if (bits % 8) element[size - 1] &= (1 << (bits % 8)) - 1;
+            if (std::find(elements.begin(), elements.end(), element) == elements.end()) elements.push_back(element);
+        }
+        bool wide = false;
+        for (const auto& element : elements) {
+            for (size_t j = 8; j < size; ++j) wide |= element[j] != 0;
+        }
+        std::sort(elements.begin(), elements.end());
+        for (auto& sketch : sketches) {
+            CHECK(sketch.GetElementSize() == size);
+            for (const auto& element : elements) sketch.AddBytes(element.data());
+        }
+        // All implementations agree, and decode exactly the elements added.
+        auto serialized_0 = sketches[0].Serialize();
+        for (auto& sketch : sketches) {
+            CHECK(sketch.Serialize() == serialized_0);
+            std::vector<unsigned char> decoded(capacity * size);
+            CHECK(sketch.DecodeBytes(decoded));
+            CHECK(decoded.size() == count * size);
+            std::vector<std::vector<unsigned char>> result;
+            for (size_t j = 0; j < count; ++j) result.emplace_back(decoded.begin() + j * size, decoded.begin() + (j + 1) * size);
+            std::sort(result.begin(), result.end());
+            CHECK(result == elements);
+            // Decoding as uint64_t works exactly when all elements fit.
+            std::vector<uint64_t> decoded64(capacity);
+            CHECK(sketch.Decode(decoded64) == !wide);
+            bool called = false;
+            CHECK(sketch.DecodeCallback(capacity, [&](uint64_t) { called = true; }) == !wide);
+            CHECK(called == (!wide && count > 0));
+            if (!wide) {
+                CHECK(decoded64.size() == count);
+                for (uint64_t element : decoded64) {
+                    std::vector<unsigned char> bytes(size);
+                    for (size_t j = 0; j < size && j < 8; ++j) bytes[j] = element >> (8 * j);
+                    CHECK(std::find(elements.begin(), elements.end(), bytes) != elements.end());
+                }
+            }
+            // Removing all elements through the uint64_t interface is equivalent, if they fit.
+            if (!wide) {
+                for (const auto& element : elements) {
+                    uint64_t val = 0;
+                    for (size_t j = 0; j < size && j < 8; ++j) val |= uint64_t{element[j]} << (8 * j);
+                    sketch.Add(val);
+                }
+                CHECK(sketch.Serialize() == Minisketch(bits, sketch.GetImplementation(), capacity).Serialize());
+            }
+        }
+    }
+}
+
+void TestAutoImplementation(uint32_t bits) {
+    if (!Minisketch::BitsSupported(bits)) return;
+    CHECK(Minisketch::ImplementationSupported(bits, MINISKETCH_IMPLEMENTATION_AUTO));
+    Minisketch sketch(bits, MINISKETCH_IMPLEMENTATION_AUTO, 16), sketch2(bits, MINISKETCH_IMPLEMENTATION_AUTO, 16);
+    CHECK(sketch && sketch2);
+    // The choice is made once per field size, and is a real implementation.
+    uint32_t impl = sketch.GetImplementation();
+    CHECK(impl <= Minisketch::MaxImplementation());
+    CHECK(Minisketch::ImplementationSupported(bits, impl));
+    CHECK(sketch2.GetImplementation() == impl);
+    // It produces the same sketches as implementation 0.
+    Minisketch reference(bits, 0, 16);
+    for (uint64_t i = 1; i <= 10; ++i) {
+        uint64_t element = (i * 0x9E3779B97F4A7C15ULL) >> (bits < 64 ? 64 - bits : 0);
+        sketch.Add(element);
+        reference.Add(element);
+    }
+    CHECK(sketch.Serialize() == reference.Serialize());
+}
+
 void TestComputeFunctions() {
     for (uint32_t bits = 0; bits <= 256; ++bits) {
         for (uint32_t fpbits = 0; fpbits <= 512; ++fpbits) {
@@ -294,6 +452,18 @@ int main(int argc, char** argv) {
 
     TestComputeFunctions();
 
+    for (unsigned j = 8; j <= 64; j += 8) {
+        TestDecodeCache(j, 16, test_complexity);
+    }
+
+    for (unsigned j = 2; j <= 128; ++j) {
+        TestAutoImplementation(j);
+    }
+
+    for (unsigned j = 8; j <= 128; ++j) {
+        TestBytes(j, 16, (test_complexity << 6) / j);
+    }
+
     for (unsigned j = 2; j <= 64; ++j) {
         TestRandomized(j, 8, (test_complexity << 10) / j);
         TestRandomized(j, 128, (test_complexity << 7) / j);